@@ -34,6 +34,10 @@ namespace Nerd {
   class cAllegro_IO : public cIO_Control {
 
     public:
+      enum Settings {
+        ATLAS_PADDING = 1
+      };
+
       ALLEGRO_BITMAP* screen;
       ALLEGRO_BITMAP* canvas;
       ALLEGRO_DISPLAY* display;
@@ -45,6 +49,16 @@ namespace Nerd {
       cHash<std::string, ALLEGRO_SAMPLE*> sounds;
       cHash<std::string, sAllegro_Track> tracks;
       cHash<std::string, ALLEGRO_BITMAP*> images;
+      int atlas_size;
+      cVector<ALLEGRO_BITMAP*> atlas_pages;
+      cVector<cAtlas_Packer*> atlas_packers;
+      ALLEGRO_BITMAP* target;
+      cVector<ALLEGRO_VERTEX> vertices;
+      bool holding;
+      bool batch_primitives;
+      void* batch_texture;
+      int batch_count;
+      int frame_batch_count;
       cArray<std::string> button_names;
       cArray<int> button_map;
       bool buttons_loaded;
@@ -66,6 +80,8 @@ namespace Nerd {
       void Silence();
       void Load_Resources(std::string name);
       void Load_Image(std::string name);
+      void Set_Atlas_Size(int size);
+      void Pack_Images();
       void Refresh();
       void Color(int red, int green, int blue);
       void Process_Messages(bool (*on_process)(void), bool (*on_key_process)(void));
@@ -78,9 +94,19 @@ namespace Nerd {
       void Display_Gamepad_Buttons();
       cArray<std::string> Get_File_List(std::string path);
       void Update_Display(cPicture_Processor* pp);
+      void Update_Display(tPicture_Processor_8* pp);
+      void Update_Display(tPicture_Processor_16* pp);
+      template <typename T> void Upload_Screen(cBasic_Picture_Processor<T>* pp);
       int Get_Text_Width(std::string text);
       int Get_Text_Height(std::string text);
       void Set_Canvas_Mode();
+      void Set_Target(ALLEGRO_BITMAP* bitmap);
+      void Begin_Image_Batch(void* texture);
+      void Begin_Primitive_Batch();
+      void Add_Triangle_Strip(const float* points, int count, ALLEGRO_COLOR color);
+      void Flush_Primitives();
+      void Flush_Batch();
+      void End_Frame();
       int Get_Image_Width(std::string name);
       int Get_Image_Height(std::string name);
       std::string Get_Current_Folder();
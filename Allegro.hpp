@@ -67,7 +67,9 @@ namespace Nerd {
       throw Nerd::cError("Could not create display.");
     }
     al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP);
+    al_set_new_bitmap_format(ALLEGRO_PIXEL_FORMAT_ARGB_8888); // Matches the palette lookup table.
     this->screen = al_create_bitmap(width, height);
+    al_set_new_bitmap_format(ALLEGRO_PIXEL_FORMAT_ANY_WITH_ALPHA);
     if (!this->screen) {
       throw Nerd::cError("Could not create screen.");
     }
@@ -97,6 +99,13 @@ namespace Nerd {
     al_register_event_source(this->event_queue, al_get_timer_event_source(this->timer));
     this->playing_track = "";
     this->scale = scale;
+    this->atlas_size = 0;
+    this->target = NULL;
+    this->holding = false;
+    this->batch_primitives = false;
+    this->batch_texture = NULL;
+    this->batch_count = 0;
+    this->frame_batch_count = 0;
     this->buttons_loaded = false;
     this->button_index = 0;
     this->mouse_axes_reg.code = eSIGNAL_NONE;
@@ -133,6 +142,11 @@ namespace Nerd {
     for (int image_index = 0; image_index < image_count; image_index++) {
       al_destroy_bitmap(this->images.values[image_index]);
     }
+    // Free the atlas pages after the images that point into them.
+    for (int page_index = 0; page_index < this->atlas_pages.Count(); page_index++) {
+      al_destroy_bitmap(this->atlas_pages[page_index]);
+      delete this->atlas_packers[page_index];
+    }
     // Free the sounds.
     int sound_count = this->sounds.Count();
     for (int sound_index = 0; sound_index < sound_count; sound_index++) {
@@ -168,6 +182,8 @@ namespace Nerd {
     if (this->images.Does_Key_Exist(name)) {
       this->Set_Canvas_Mode();
       ALLEGRO_BITMAP* image = this->images[name];
+      ALLEGRO_BITMAP* parent = al_get_parent_bitmap(image);
+      this->Begin_Image_Batch(parent ? parent : image); // Images on one atlas page share a batch.
       int image_w = al_get_bitmap_width(image);
       int image_h = al_get_bitmap_height(image);
       float scale_x = (float)(width / image_w);
@@ -202,7 +218,8 @@ namespace Nerd {
    * @param height The height of the clipping rectangle.
    */
   void cAllegro_IO::Draw_Canvas(int x, int y, int width, int height) {
-    al_set_target_bitmap(this->screen);
+    this->Set_Target(this->screen);
+    this->Begin_Image_Batch(this->canvas);
     al_draw_bitmap_region(this->canvas, 0, 0, width, height, x, y, 0);
   }
 
@@ -232,6 +249,7 @@ namespace Nerd {
    */
   void cAllegro_IO::Output_Text(std::string text, int x, int y, int red, int green, int blue) {
     this->Set_Canvas_Mode();
+    this->Begin_Image_Batch(this->font); // The glyphs live on the font's own pages.
     al_draw_text(this->font, al_map_rgb((unsigned char)red, (unsigned char)green, (unsigned char)blue), x, y - 1, 0, text.c_str());
   }
 
@@ -247,7 +265,24 @@ namespace Nerd {
    */
   void cAllegro_IO::Box(int x, int y, int width, int height, int red, int green, int blue) {
     this->Set_Canvas_Mode();
-    al_draw_filled_rectangle(x, y, x + width - 1, y + height - 1, al_map_rgb((unsigned char)red, (unsigned char)green, (unsigned char)blue));
+    this->Begin_Primitive_Batch();
+    if (this->batch_primitives) {
+      float left = x;
+      float top = y;
+      float right = x + width - 1;
+      float bottom = y + height - 1;
+      float points[] = {
+        left, top,
+        right, top,
+        left, bottom,
+        right, bottom
+      };
+      this->Add_Triangle_Strip(points, 4, al_map_rgb((unsigned char)red, (unsigned char)green, (unsigned char)blue));
+    }
+    else {
+      al_draw_filled_rectangle(x, y, x + width - 1, y + height - 1, al_map_rgb((unsigned char)red, (unsigned char)green, (unsigned char)blue));
+      this->batch_count++;
+    }
   }
 
   /**
@@ -262,11 +297,37 @@ namespace Nerd {
    */
   void cAllegro_IO::Frame(int x, int y, int width, int height, int red, int green, int blue) {
     this->Set_Canvas_Mode();
-    al_draw_rectangle(x, y, x + width - 1, y + height - 1, al_map_rgb((unsigned char)red, (unsigned char)green, (unsigned char)blue), 1);
+    this->Begin_Primitive_Batch();
+    if (this->batch_primitives) {
+      // The outline is one pixel thick, centered on the edges like al_draw_rectangle.
+      float left = x;
+      float top = y;
+      float right = x + width - 1;
+      float bottom = y + height - 1;
+      float half = 0.5f;
+      float points[] = {
+        left - half, top - half,
+        left + half, top + half,
+        right + half, top - half,
+        right - half, top + half,
+        right + half, bottom + half,
+        right - half, bottom - half,
+        left - half, bottom + half,
+        left + half, bottom - half,
+        left - half, top - half,
+        left + half, top + half
+      };
+      this->Add_Triangle_Strip(points, 10, al_map_rgb((unsigned char)red, (unsigned char)green, (unsigned char)blue));
+    }
+    else {
+      al_draw_rectangle(x, y, x + width - 1, y + height - 1, al_map_rgb((unsigned char)red, (unsigned char)green, (unsigned char)blue), 1);
+      this->batch_count++;
+    }
   }
 
   /**
-   * Loads a list of resources from a resource file.
+   * Loads a list of resources from a resource file. Images are packed into
+   * atlas pages if an atlas size was set.
    * @param name The name of the resource file with the resource names.
    * @throws An error if the resources could not be loaded.
    */
@@ -326,6 +387,9 @@ namespace Nerd {
           }
         }
       }
+      if (this->atlas_size > 0) {
+        this->Pack_Images();
+      }
     }
     else {
       throw Nerd::cError("Could not load resources.");
@@ -341,12 +405,91 @@ namespace Nerd {
     ALLEGRO_BITMAP* image = al_load_bitmap(std::string(name + ".png").c_str());
     if (image) {
       this->images[name] = image;
+      if (this->atlas_size > 0) {
+        this->Pack_Images();
+      }
     }
     else {
       throw Nerd::cError("Could not load image " + name + ".");
     }
   }
 
+  /**
+   * Sets the size of the atlas pages that images are packed into when they
+   * are loaded. Packed images are sub-bitmaps of a few large pages. Images
+   * that do not fit on a page stay on their own. Pages are made with the
+   * same new-bitmap flags as the loaded images, and those are memory bitmaps
+   * here since the screen and canvas are drawn in memory. Packing then only
+   * saves bitmaps. It cuts texture switches once the images and the target
+   * they are drawn on are video bitmaps.
+   * @param size The width and height of a page. Zero turns packing off.
+   */
+  void cAllegro_IO::Set_Atlas_Size(int size) {
+    int max_size = al_get_display_option(this->display, ALLEGRO_MAX_BITMAP_SIZE);
+    this->atlas_size = ((max_size > 0) && (size > max_size)) ? max_size : size;
+  }
+
+  /**
+   * Packs the images that are not on an atlas page yet. The tallest images
+   * go first since that packs the skyline tighter. Each image is copied onto
+   * the first page with room, or onto a new page, and then replaced by a
+   * sub-bitmap of the page so that drawing it is unchanged. The new-bitmap
+   * flags are left as they were.
+   * @throws An error if a page could not be created.
+   */
+  void cAllegro_IO::Pack_Images() {
+    this->Flush_Batch(); // Copying onto the pages must not be held.
+    cVector<int> order;
+    int image_count = this->images.Count();
+    for (int image_index = 0; image_index < image_count; image_index++) {
+      if (!al_is_sub_bitmap(this->images.values[image_index])) {
+        order.Add(image_index);
+      }
+    }
+    std::sort(order.begin(), order.end(), [this](int left, int right) {
+      return (al_get_bitmap_height(this->images.values[left]) > al_get_bitmap_height(this->images.values[right]));
+    });
+    ALLEGRO_STATE state;
+    al_store_state(&state, ALLEGRO_STATE_TARGET_BITMAP | ALLEGRO_STATE_BLENDER | ALLEGRO_STATE_NEW_BITMAP_PARAMETERS);
+    al_set_blender(ALLEGRO_ADD, ALLEGRO_ONE, ALLEGRO_ZERO); // Copy the pixels as they are.
+    for (int order_index = 0; order_index < order.Count(); order_index++) {
+      ALLEGRO_BITMAP*& image = this->images.values[order[order_index]];
+      int width = al_get_bitmap_width(image);
+      int height = al_get_bitmap_height(image);
+      // Leave a gap so filtering does not bleed in from a neighbor.
+      int cell_w = width + ATLAS_PADDING;
+      int cell_h = height + ATLAS_PADDING;
+      if ((cell_w <= this->atlas_size) && (cell_h <= this->atlas_size)) {
+        sPoint position = { 0, 0 };
+        int page_index = 0;
+        while ((page_index < this->atlas_packers.Count()) && !this->atlas_packers[page_index]->Insert(cell_w, cell_h, position)) {
+          page_index++;
+        }
+        if (page_index == this->atlas_packers.Count()) { // Start a new page.
+          ALLEGRO_BITMAP* page = al_create_bitmap(this->atlas_size, this->atlas_size);
+          if (!page) {
+            al_restore_state(&state);
+            throw Nerd::cError("Could not create atlas page.");
+          }
+          al_set_target_bitmap(page);
+          al_clear_to_color(al_map_rgba(0, 0, 0, 0));
+          this->atlas_pages.Add(page);
+          this->atlas_packers.Add(new cAtlas_Packer(this->atlas_size, this->atlas_size));
+          this->atlas_packers[page_index]->Insert(cell_w, cell_h, position);
+        }
+        ALLEGRO_BITMAP* page = this->atlas_pages[page_index];
+        ALLEGRO_BITMAP* sub_image = al_create_sub_bitmap(page, position.x, position.y, width, height);
+        if (sub_image) {
+          al_set_target_bitmap(page);
+          al_draw_bitmap(image, position.x, position.y, 0);
+          al_destroy_bitmap(image);
+          image = sub_image;
+        }
+      }
+    }
+    al_restore_state(&state);
+  }
+
   /**
    * Processes messages for Allegro. This blocks.
    * @param on_process Called when the app needs to be processed.
@@ -538,11 +681,12 @@ namespace Nerd {
     ALLEGRO_BITMAP* backbuffer = al_get_backbuffer(display);
     int screen_w = al_get_bitmap_width(this->screen);
     int screen_h = al_get_bitmap_height(this->screen);
-    al_set_target_bitmap(backbuffer);
+    this->Set_Target(backbuffer);
     int buffer_w = al_get_bitmap_width(backbuffer);
     int buffer_h = al_get_bitmap_height(backbuffer);
     al_draw_scaled_bitmap(this->screen, 0, 0, screen_w, screen_h, 0, 0, buffer_w, buffer_h, 0);
-    al_flip_display();
+    this->batch_count++;
+    this->End_Frame();
   }
 
   /**
@@ -553,6 +697,7 @@ namespace Nerd {
    */
   void cAllegro_IO::Color(int red, int green, int blue) {
     this->Set_Canvas_Mode();
+    this->Flush_Batch(); // Clearing is not held back.
     al_clear_to_color(al_map_rgb((unsigned char)red, (unsigned char)green, (unsigned char)blue));
   }
 
@@ -689,7 +834,8 @@ namespace Nerd {
    * Display gamepad buttons.
    */
   void cAllegro_IO::Display_Gamepad_Buttons() {
-    al_set_target_bitmap(this->screen);
+    this->Set_Target(this->screen);
+    this->Flush_Batch();
     al_clear_to_color(al_map_rgb(255, 255, 255));
     std::string text = "Press the " + this->button_names[this->button_index] + " button.";
     int text_width = al_get_text_width(this->font, text.c_str());
@@ -736,27 +882,69 @@ namespace Nerd {
    * @param pp The picture processor reference.
    */
   void cAllegro_IO::Update_Display(cPicture_Processor* pp) {
-    ALLEGRO_LOCKED_REGION* region = al_lock_bitmap(this->screen, ALLEGRO_PIXEL_FORMAT_RGB_888, ALLEGRO_LOCK_READWRITE);
-    if (region) {
-      // Draw the screen.
-      for (int y = 0; y < pp->height; y++) {
-        for (int x = 0; x < pp->width; x++) {
-          sColor color = pp->palette[pp->screen[y][x]];
-          unsigned char* pixels = (unsigned char*)region->data;
-          pixels[(y * region->pitch) + (region->pixel_size * x) + 0] = color.red;
-          pixels[(y * region->pitch) + (region->pixel_size * x) + 1] = color.green;
-          pixels[(y * region->pitch) + (region->pixel_size * x) + 2] = color.blue;
-        }
+    this->Upload_Screen(pp);
+  }
+
+  /**
+   * Updates the display using an 8-bit screen and palette.
+   * @param pp The picture processor reference.
+   */
+  void cAllegro_IO::Update_Display(tPicture_Processor_8* pp) {
+    this->Upload_Screen(pp);
+  }
+
+  /**
+   * Updates the display using a 16-bit screen and palette.
+   * @param pp The picture processor reference.
+   */
+  void cAllegro_IO::Update_Display(tPicture_Processor_16* pp) {
+    this->Upload_Screen(pp);
+  }
+
+  /**
+   * Converts the changed parts of the picture processor's screen through the
+   * palette lookup table and shows the screen. Only the dirty rectangles are
+   * locked and converted, in the 32-bit ARGB format that the lookup table
+   * holds. The number of pixels sent is kept in pixels_uploaded. Commands
+   * still being recorded are rendered first.
+   * @param pp The picture processor reference.
+   */
+  template <typename T> void cAllegro_IO::Upload_Screen(cBasic_Picture_Processor<T>* pp) {
+    if (pp->recording) {
+      pp->Render_Commands();
+    }
+    this->Flush_Batch(); // Nothing may be held for the screen while it is locked.
+    bool uploaded = true;
+    pp->pixels_uploaded = 0;
+    for (int rect_index = 0; rect_index < pp->dirty_rects.Count(); rect_index++) {
+      sRectangle& rect = pp->dirty_rects[rect_index];
+      int width = rect.right - rect.left + 1;
+      int height = rect.bottom - rect.top + 1;
+      ALLEGRO_LOCKED_REGION* region = al_lock_bitmap_region(this->screen, rect.left, rect.top, width, height, ALLEGRO_PIXEL_FORMAT_ARGB_8888, ALLEGRO_LOCK_WRITEONLY);
+      if (!region) {
+        uploaded = false; // Try again next time.
+        break;
+      }
+      // Convert the rectangle one row at a time.
+      unsigned char* target = (unsigned char*)region->data;
+      for (int y = 0; y < height; y++) {
+        pp->Convert_Row((unsigned int*)target, rect.left, rect.top + y, width);
+        target += region->pitch;
       }
-      al_unlock_bitmap(screen);
-      // Draw screen to display.
-      ALLEGRO_BITMAP* backbuffer = al_get_backbuffer(display);
-      al_set_target_bitmap(backbuffer);
-      int width = al_get_bitmap_width(backbuffer);
-      int height = al_get_bitmap_height(backbuffer);
-      al_draw_scaled_bitmap(this->screen, 0, 0, pp->width, pp->height, 0, 0, width, height, 0);
-      al_flip_display();
+      al_unlock_bitmap(this->screen);
+      pp->pixels_uploaded += width * height;
     }
+    if (uploaded) {
+      pp->Clear_Dirty();
+    }
+    // Draw screen to display.
+    ALLEGRO_BITMAP* backbuffer = al_get_backbuffer(display);
+    this->Set_Target(backbuffer);
+    int width = al_get_bitmap_width(backbuffer);
+    int height = al_get_bitmap_height(backbuffer);
+    al_draw_scaled_bitmap(this->screen, 0, 0, pp->width, pp->height, 0, 0, width, height, 0);
+    this->batch_count++;
+    this->End_Frame();
   }
 
   /**
@@ -782,13 +970,121 @@ namespace Nerd {
    */
   void cAllegro_IO::Set_Canvas_Mode() {
     if (this->use_canvas) {
-      al_set_target_bitmap(this->canvas);
+      this->Set_Target(this->canvas);
     }
     else {
-      al_set_target_bitmap(this->screen);
+      this->Set_Target(this->screen);
+    }
+  }
+
+  /**
+   * Sets the bitmap to draw on. Nothing happens if it is already the target,
+   * otherwise whatever was batched for the old target is drawn first. Boxes
+   * and frames are only batched on video bitmaps. A memory bitmap is drawn in
+   * software where a batch saves nothing, so they are drawn right away.
+   * @param bitmap The bitmap to draw on.
+   */
+  void cAllegro_IO::Set_Target(ALLEGRO_BITMAP* bitmap) {
+    if (bitmap != this->target) {
+      this->Flush_Batch();
+      al_set_target_bitmap(bitmap);
+      this->target = bitmap;
+      this->batch_primitives = ((al_get_bitmap_flags(bitmap) & ALLEGRO_MEMORY_BITMAP) == 0);
+    }
+  }
+
+  /**
+   * Gets ready to draw a bitmap. Pending primitives are drawn first to keep
+   * the drawing order, then bitmap drawing is held so Allegro can join draws
+   * that use the same texture. A new texture counts as a batch.
+   * @param texture The bitmap or font that is drawn from.
+   */
+  void cAllegro_IO::Begin_Image_Batch(void* texture) {
+    this->Flush_Primitives();
+    if (!this->holding) {
+      al_hold_bitmap_drawing(true);
+      this->holding = true;
+      this->batch_texture = NULL;
+    }
+    if (texture != this->batch_texture) {
+      this->batch_texture = texture;
+      this->batch_count++;
     }
   }
 
+  /**
+   * Gets ready to add primitives. Held bitmaps are drawn first to keep the
+   * drawing order.
+   */
+  void cAllegro_IO::Begin_Primitive_Batch() {
+    if (this->holding) {
+      al_hold_bitmap_drawing(false);
+      this->holding = false;
+      this->batch_texture = NULL;
+    }
+  }
+
+  /**
+   * Adds a triangle strip to the pending primitives as a list of triangles
+   * so that strips of many shapes can go out in one call.
+   * @param points The x and y coordinates of the strip.
+   * @param count The number of points.
+   * @param color The color of the strip.
+   */
+  void cAllegro_IO::Add_Triangle_Strip(const float* points, int count, ALLEGRO_COLOR color) {
+    for (int triangle_index = 0; triangle_index < (count - 2); triangle_index++) {
+      for (int corner_index = 0; corner_index < 3; corner_index++) {
+        const float* point = points + ((triangle_index + corner_index) * 2);
+        ALLEGRO_VERTEX& vertex = this->vertices.Add();
+        vertex.x = point[0];
+        vertex.y = point[1];
+        vertex.z = 0;
+        vertex.u = 0;
+        vertex.v = 0;
+        vertex.color = color;
+      }
+    }
+  }
+
+  /**
+   * Draws the pending primitives in one call.
+   */
+  void cAllegro_IO::Flush_Primitives() {
+    int vertex_count = this->vertices.Count();
+    if (vertex_count > 0) {
+      al_draw_prim(this->vertices.Data(), NULL, NULL, 0, vertex_count, ALLEGRO_PRIM_TRIANGLE_LIST);
+      this->vertices.Clear();
+      this->batch_count++;
+    }
+  }
+
+  /**
+   * Draws everything that is batched, primitives and held bitmaps.
+   */
+  void cAllegro_IO::Flush_Batch() {
+    this->Flush_Primitives();
+    if (this->holding) {
+      al_hold_bitmap_drawing(false);
+      this->holding = false;
+      this->batch_texture = NULL;
+    }
+  }
+
+  /**
+   * Shows the back buffer and starts counting batches for the next frame.
+   * The count of the frame that ended is kept in frame_batch_count. A batch
+   * is a logical count kept here: a primitive flush, a box or frame drawn
+   * right away, a change of texture while bitmap drawing is held, or the
+   * screen blit. It is not a count of GPU submissions, and holding does
+   * nothing for memory bitmaps.
+   */
+  void cAllegro_IO::End_Frame() {
+    this->Flush_Batch();
+    al_flip_display();
+    this->frame_batch_count = this->batch_count;
+    this->batch_count = 0;
+  }
+
   /**
    * Gets the width of the image.
    * @param name The name of the image.
@@ -871,7 +1167,8 @@ namespace Nerd {
   }
 
   /**
-   * Loads the resources from the file system. 
+   * Loads the resources from the file system. Images are packed into atlas
+   * pages if an atlas size was set.
    */
   void cAllegro_IO::Load_Resources_From_Files() {
     cArray<std::string> files = this->Get_File_List(this->Get_Current_Folder());
@@ -919,6 +1216,9 @@ namespace Nerd {
         }
       }
     }
+    if (this->atlas_size > 0) {
+      this->Pack_Images();
+    }
   }
 
   /**
@@ -7,16 +7,78 @@
 #include <fstream>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <chrono>
 #include <cstdlib>
 #include <cmath>
 #include <cstring>
+#include <climits>
+#include <cstdio>
+#include <utility>
+#include <functional>
+#include <new>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+#ifndef _WIN32
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+// Bounds checking on array access is on unless this is a release build.
+#ifndef NERD_BOUNDS_CHECK
+  #ifdef NDEBUG
+    #define NERD_BOUNDS_CHECK 0
+  #else
+    #define NERD_BOUNDS_CHECK 1
+  #endif
+#endif
+
+// SIMD blitting is on for x86-64 where SSE2 is always present. AVX2 is
+// picked at runtime.
+#ifndef NERD_SIMD
+  #if defined(__x86_64__) || defined(_M_X64)
+    #define NERD_SIMD 1
+  #else
+    #define NERD_SIMD 0
+  #endif
+#endif
+
+#if NERD_SIMD
+  #include <immintrin.h>
+  #ifdef _MSC_VER
+    #include <intrin.h>
+    #define NERD_TARGET_AVX2
+  #else
+    #define NERD_TARGET_AVX2 __attribute__((target("avx2")))
+  #endif
+#endif
+
+// The AVX2 kernels keep 32-byte vectors on the stack. 64-bit MinGW does not
+// align the stack for them (GCC bug 54412) so they are never picked there.
+#ifndef NERD_AVX2
+  #if NERD_SIMD && !defined(__MINGW32__)
+    #define NERD_AVX2 1
+  #else
+    #define NERD_AVX2 0
+  #endif
+#endif
 
 namespace Nerd {
 
   const int NO_VALUE_FOUND = -1;
   const int TAKE_NO_JUMP = -1;
   const int BLINK_RATE = 500;
+  const int NUMBER_TEXT_SIZE = 12;
+  const int OBJECT_FILE_VERSION = 1;
+  const int TABLE_FILE_VERSION = 2;
+  const int TABLE_FILE_HEADER_SIZE = 20;
+  const int MEMORY_ALIGNMENT = 64;
 
   enum eValue_Type {
     eVALUE_NUMBER,
@@ -60,12 +122,65 @@ namespace Nerd {
     eSTATUS_DONE
   };
 
+  enum eNumber_Status {
+    eNUMBER_OK,
+    eNUMBER_EMPTY,
+    eNUMBER_INVALID,
+    eNUMBER_OVERFLOW
+  };
+
+  enum eObject_File_Flag {
+    eOBJECT_FILE_DICTIONARY = 1
+  };
+
+  enum eTable_Mapping {
+    eTABLE_MAP_READ_ONLY,
+    eTABLE_MAP_COPY_ON_WRITE
+  };
+
+  enum eAtom : int {
+    eATOM_ID,
+    eATOM_TYPE,
+    eATOM_X,
+    eATOM_Y,
+    eATOM_WIDTH,
+    eATOM_HEIGHT,
+    eATOM_TEXT,
+    eATOM_LABEL,
+    eATOM_RED,
+    eATOM_GREEN,
+    eATOM_BLUE,
+    eATOM_ROWS,
+    eATOM_COLUMNS,
+    eATOM_ITEMS,
+    eATOM_SCROLL_X,
+    eATOM_SCROLL_Y,
+    eATOM_GRID_X,
+    eATOM_GRID_Y,
+    eATOM_SEL_ITEM,
+    eATOM_ITEM_X,
+    eATOM_ITEM_Y,
+    eATOM_COUNT
+  };
+
   enum eDraw_Mode {
     eDRAW_NORMAL,
     eDRAW_FLIPPED_X,
     eDRAW_FLIPPED_Y
   };
 
+  enum eDraw_Command {
+    eCOMMAND_PICTURE,
+    eCOMMAND_COMPILED_PICTURE,
+    eCOMMAND_FILL
+  };
+
+  enum eSIMD_Level {
+    eSIMD_SCALAR,
+    eSIMD_SSE2,
+    eSIMD_AVX2
+  };
+
   struct sPoint {
     int x;
     int y;
@@ -103,6 +218,28 @@ namespace Nerd {
     int blue;
   };
 
+  struct sLine_Span {
+    int start;
+    int length;
+  };
+
+  struct sPicture_Span {
+    int start;
+    int length;
+    int offset;
+  };
+
+  struct sSkyline_Node {
+    int x;
+    int y;
+    int width;
+  };
+
+  struct sHash_Slot {
+    int index;
+    unsigned int hash;
+  };
+
   class cError {
 
     public:
@@ -121,6 +258,19 @@ namespace Nerd {
         TABLE_INCR = 10
       };
 
+      class cIterator {
+
+        public:
+          T** items;
+          int index;
+
+          cIterator(T** items, int index);
+          T& operator* ();
+          cIterator& operator++ ();
+          bool operator!= (const cIterator& other);
+
+      };
+
       T** items;
       int pointer;
       int block_count;
@@ -129,14 +279,21 @@ namespace Nerd {
       cArray();
       cArray(const cArray& other);
       cArray(cArray& other);
+      cArray(cArray&& other);
       ~cArray();
       cArray& operator= (const cArray& other);
       cArray& operator= (cArray& other);
+      cArray& operator= (cArray&& other);
       T& operator[] (int index);
-      void Add(T item);
+      T& At_Unchecked(int index);
+      cIterator begin();
+      cIterator end();
+      void Add(const T& item);
+      void Add(T&& item);
       T& Add();
       T Remove(int index);
-      void Push(T item);
+      void Push(const T& item);
+      void Push(T&& item);
       T Pop();
       void Unshift(T item);
       T Shift();
@@ -156,21 +313,148 @@ namespace Nerd {
 
   };
 
-  typedef cArray<sLetter> tLine;
+  template <typename T> class cVector {
 
-  template <typename K, typename V> class cHash {
+    public:
+      enum Settings {
+        MIN_CAPACITY = 8
+      };
+
+      T* items;
+      int pointer;
+      int capacity;
+
+      cVector();
+      cVector(const cVector& other);
+      cVector(cVector&& other);
+      ~cVector();
+      cVector& operator= (const cVector& other);
+      cVector& operator= (cVector&& other);
+      T& operator[] (int index);
+      T& At_Unchecked(int index);
+      T* begin();
+      T* end();
+      void Add(const T& item);
+      void Add(T&& item);
+      T& Add();
+      T Remove(int index);
+      void Push(const T& item);
+      void Push(T&& item);
+      T Pop();
+      void Unshift(T item);
+      T Shift();
+      void Insert(T item, int index);
+      int Count();
+      void Grow();
+      void Reserve(int size);
+      void Shrink_To_Fit();
+      void Copy(const cVector& other);
+      T* Data();
+      void Free();
+      int Get_Size();
+      void Clear();
+      T& Peek_Front();
+      T& Peek_Back();
+
+  };
+
+  template <typename T> class cDeque {
 
     public:
+      enum Settings {
+        MIN_CAPACITY = 8
+      };
+
+      T* items;
+      int head;
+      int pointer;
+      int capacity;
+
+      cDeque();
+      cDeque(const cDeque& other);
+      cDeque(cDeque&& other);
+      ~cDeque();
+      cDeque& operator= (const cDeque& other);
+      cDeque& operator= (cDeque&& other);
+      T& operator[] (int index);
+      T& At_Unchecked(int index);
+      void Push(const T& item);
+      void Push(T&& item);
+      T Pop();
+      void Unshift(const T& item);
+      void Unshift(T&& item);
+      T Shift();
+      T Remove(int index);
+      int Count();
+      void Grow();
+      void Reserve(int size);
+      void Copy(const cDeque& other);
+      void Free();
+      int Get_Size();
+      void Clear();
+      T& Peek_Front();
+      T& Peek_Back();
+
+  };
+
+  typedef cVector<sLetter> tLine;
+
+  template <typename K, typename V, typename H = std::hash<K> > class cHash {
+
+    public:
+      enum Settings {
+        MIN_SLOTS = 8,
+        ATOM_SCAN_LIMIT = 32
+      };
+
       cArray<K> keys;
       cArray<V> values;
-
+      cVector<int> atoms;
+      sHash_Slot* slots;
+      int slot_count;
+      H hasher;
+
+      cHash();
+      cHash(const cHash& other);
+      cHash(cHash&& other);
+      ~cHash();
+      cHash& operator=(const cHash& other);
+      cHash& operator=(cHash&& other);
       void Add(K key, V value);
-      void Remove(K key);
-      V& operator[](K key);
-      int Get_Hash_Key(K key);
+      void Remove(const K& key);
+      V& operator[](const K& key);
+      V& operator[](eAtom atom);
+      int Get_Hash_Key(const K& key);
+      int Get_Hash_Key(eAtom atom);
       void Clear();
       int Count();
-      bool Does_Key_Exist(K key);
+      bool Does_Key_Exist(const K& key);
+      bool Does_Key_Exist(eAtom atom);
+      unsigned int Hash(const K& key);
+      int Find_Slot(const K& key);
+      void Insert_Slot(int index, unsigned int hash);
+      int Get_Probe_Distance(int slot_index);
+      void Rehash(int count);
+      void Copy_Slots(const cHash& other);
+
+  };
+
+  class cTokenizer {
+
+    public:
+      std::string_view text;
+      int position;
+      char delimiter;
+      bool whitespace;
+
+      cTokenizer(std::string_view text, char delimiter);
+      cTokenizer(std::string_view text);
+      bool Next(std::string_view& token);
+      bool Has_More_Tokens();
+      int Count();
+      int Split(std::string_view* tokens, int max_count);
+      std::string_view Get_Token(int index);
+      void Rewind();
 
   };
 
@@ -184,9 +468,12 @@ namespace Nerd {
       cValue();
       cValue(int number);
       cValue(std::string string);
+      cValue(const cValue& other);
+      cValue(cValue&& other);
       void Set_Number(int number);
       void Set_String(std::string string);
       cValue& operator=(const cValue& other);
+      cValue& operator=(cValue&& other);
       void operator=(const int number);
       void operator=(const std::string string);
       void Convert_To_Number();
@@ -194,18 +481,33 @@ namespace Nerd {
 
   };
 
+  class cAtom_Table {
+
+    public:
+      cVector<std::string> names;
+      cHash<std::string, int> atoms;
+
+      cAtom_Table();
+      eAtom Intern(const std::string& name);
+      std::string& Get_Name(eAtom atom);
+
+  };
+
   typedef cHash<std::string, cValue> tObject;
   typedef cArray<tObject> tObject_List;
 
   class cList {
 
     public:
-      cArray<int> items;
+      cVector<int> items;
 
       cList();
       cList(int size);
+      cList(const cList& other);
+      cList(cList&& other);
       int& operator[](int index);
       cList& operator=(const cList& other);
+      cList& operator=(cList&& other);
       void Clear();
       void Add(int value);
       void Remove(int index);
@@ -222,62 +524,248 @@ namespace Nerd {
 
       cMatrix();
       cMatrix(int width, int height);
+      cMatrix(const cMatrix& other);
+      cMatrix(cMatrix&& other);
       cList& operator[](int index);
-      cList& operator=(const cList& other);
+      cMatrix& operator=(const cMatrix& other);
+      cMatrix& operator=(cMatrix&& other);
       void Clear();
       void Resize(int width, int height);
 
   };
 
-  class cTable {
+  template <typename T> class cBasic_Table {
 
     public:
       int width;
       int height;
       int row_pointer;
       int col_pointer;
-      int** rows;
-
-      cTable(int width, int height);
-      ~cTable();
+      T** rows;
+      T* data;
+      int stride;
+      void* mapping;
+      std::size_t mapping_size;
+
+      cBasic_Table(int width, int height);
+      cBasic_Table(const cBasic_Table<T>& other);
+      cBasic_Table(cBasic_Table<T>&& other);
+      ~cBasic_Table();
       void Move_To_Next_Row();
-      int Read_Column();
+      T Read_Column();
       void Move_To_Column(int index);
-      void Write_Column(int value);
+      void Write_Column(T value);
       void Rewind();
-      cTable& operator=(cTable& other);
+      cBasic_Table<T>& operator=(const cBasic_Table<T>& other);
+      cBasic_Table<T>& operator=(cBasic_Table<T>&& other);
       void Clear();
       void Move_To_Row(int index);
       void Load_From_File(std::string name);
       void Save_To_File(std::string name);
+      void Load_From_Binary_File(std::string name);
+      void Load_From_Binary_File(std::string name, eTable_Mapping mode);
+      void Save_To_Binary_File(std::string name);
+      bool Is_Mapped();
       void Resize(int width, int height);
       void Dump();
+      void Fill(T value);
+      T* Get_Row(int index);
+      void Allocate_Rows(int width, int height);
+      void Free_Rows();
 
   };
 
-  class cPicture_Processor {
+  typedef cBasic_Table<int> cTable;
+  typedef cBasic_Table<unsigned char> tTable_8;
+  typedef cBasic_Table<unsigned short> tTable_16;
+
+  template <typename T> class cCompiled_Picture {
+
+    public:
+      enum Settings {
+        MODE_COUNT = 4,
+        SHORT_SPAN = 8
+      };
+
+      int width;
+      int height;
+      cVector<T> pixels[MODE_COUNT];
+      cVector<sPicture_Span> spans[MODE_COUNT];
+      cVector<int> row_spans[MODE_COUNT];
+
+      cCompiled_Picture();
+      cCompiled_Picture(cBasic_Table<T>& picture);
+      void Compile(cBasic_Table<T>& picture);
+      void Load(std::string name);
+      void Clear();
+
+  };
+
+  typedef cCompiled_Picture<int> tCompiled_Picture;
+  typedef cCompiled_Picture<unsigned char> tCompiled_Picture_8;
+  typedef cCompiled_Picture<unsigned short> tCompiled_Picture_16;
+
+  template <typename T> struct sDraw_Command {
+    int type;
+    int x;
+    int y;
+    int mode;
+    int width;
+    int height;
+    T** rows;
+    cCompiled_Picture<T>* picture;
+    T color_index;
+  };
+
+  class cWorker_Pool {
+
+    public:
+      std::thread* threads;
+      int worker_count;
+      std::mutex lock;
+      std::mutex run_lock;
+      std::condition_variable wake;
+      std::condition_variable done;
+      std::function<void(int)> task;
+      int task_count;
+      std::atomic<int> next_task;
+      int busy_count;
+      int generation;
+      bool stopping;
+      bool failed;
+      std::string error;
+
+      cWorker_Pool(int worker_count);
+      ~cWorker_Pool();
+      void Run(int task_count, std::function<void(int)> task);
+      int Get_Thread_Count();
+      void Worker_Loop();
+      void Work();
+      void Record_Error(std::string message);
+
+  };
+
+  template <typename T> class cBasic_Picture_Processor {
 
     public:
+      enum Settings {
+        MAX_DIRTY_RECTS = 32,
+        MIN_BAND_HEIGHT = 8,
+        BANDS_PER_THREAD = 4
+      };
+
       int width;
       int height;
       int palette_size;
       sColor* palette;
-      int** screen;
-
-      cPicture_Processor(int width, int height);
-      ~cPicture_Processor();
+      unsigned int* palette_lut;
+      int palette_lut_size;
+      T** screen;
+      T* pixels;
+      int stride;
+      cVector<sRectangle> dirty_rects;
+      int pixels_uploaded;
+      bool recording;
+      cVector<sDraw_Command<T> > commands;
+      int command_frame;
+
+      cBasic_Picture_Processor(int width, int height);
+      ~cBasic_Picture_Processor();
       void Load_Palette(std::string name);
-      void Draw_Picture(cTable& picture, int x, int y, int mode);
+      void Draw_Picture(cBasic_Table<T>& picture, int x, int y, int mode);
+      void Draw_Picture(cCompiled_Picture<T>& picture, int x, int y, int mode);
       void Clear_Screen(sColor color);
+      void Fill_Screen(T color_index);
       int Scan_Palette(sColor color);
       void Dump();
+      void Mark_Dirty(int x, int y, int width, int height);
+      void Mark_All_Dirty();
+      void Clear_Dirty();
+      void Build_Palette_LUT();
+      void Convert_Row(unsigned int* target, int x, int y, int count);
+      void Begin_Commands();
+      void Render_Commands();
+      void Render_Commands(cWorker_Pool& pool);
+      void Run_Command(sDraw_Command<T>& command, int band_top, int band_bottom);
+      void Blit_Picture(sDraw_Command<T>& command, int band_top, int band_bottom);
+      void Blit_Compiled_Picture(sDraw_Command<T>& command, int band_top, int band_bottom);
+      void Fill_Rows(T color_index, int band_top, int band_bottom);
+
+  };
+
+  typedef cBasic_Picture_Processor<int> cPicture_Processor;
+  typedef cBasic_Picture_Processor<unsigned char> tPicture_Processor_8;
+  typedef cBasic_Picture_Processor<unsigned short> tPicture_Processor_16;
+
+  template <typename T> struct sTile_Chunk {
+    int chunk_x;
+    int chunk_y;
+    int last_used;
+    cBasic_Table<T>* picture;
+  };
+
+  template <typename T> class cTile_Map {
+
+    public:
+      enum Settings {
+        CHUNK_SIZE = 16,
+        MAX_CHUNKS = 64
+      };
+
+      cTable* map;
+      cVector<cCompiled_Picture<T>*> tiles;
+      int tile_width;
+      int tile_height;
+      int scroll_x;
+      int scroll_y;
+      bool use_chunks;
+      sTile_Chunk<T> chunks[MAX_CHUNKS];
+      int frame;
+      cBasic_Picture_Processor<T>* recorded_pp;
+      int recorded_frame;
+
+      cTile_Map(cTable& map);
+      ~cTile_Map();
+      int Add_Tile(cBasic_Table<T>& picture);
+      void Set_Tile(int x, int y, int tile);
+      int Get_Tile(int x, int y);
+      void Set_Scroll(int x, int y);
+      void Scroll(int x_amount, int y_amount);
+      void Use_Chunks(bool use_chunks);
+      void Invalidate_Chunks();
+      void Render(cBasic_Picture_Processor<T>& pp);
+      void Render_Tiles(cBasic_Picture_Processor<T>& pp, int left, int top, int right, int bottom);
+      sTile_Chunk<T>* Get_Chunk(int chunk_x, int chunk_y);
+      void Build_Chunk(sTile_Chunk<T>& chunk);
+      cCompiled_Picture<T>* Get_Tile_Picture(int tile);
+      void Submit(cBasic_Picture_Processor<T>& pp, sDraw_Command<T>& command);
+
+  };
+
+  typedef cTile_Map<int> tTile_Map;
+  typedef cTile_Map<unsigned char> tTile_Map_8;
+  typedef cTile_Map<unsigned short> tTile_Map_16;
+
+  class cAtlas_Packer {
+
+    public:
+      int width;
+      int height;
+      cVector<sSkyline_Node> skyline;
+      int used_area;
+
+      cAtlas_Packer(int width, int height);
+      bool Insert(int width, int height, sPoint& position);
+      int Fit_Rectangle(int node_index, int width, int height);
+      void Add_Rectangle(int node_index, int x, int y, int width, int height);
+      void Clear();
 
   };
 
   class cIO_Control {
 
     public:
-      cArray<sSignal> signal_buffer;
+      cDeque<sSignal> signal_buffer;
       bool use_canvas;
       int width;
       int height;
@@ -299,10 +787,16 @@ namespace Nerd {
       virtual void Refresh();
       virtual void Color(int red, int green, int blue);
       virtual void Update_Display(cPicture_Processor* pp);
+      virtual void Update_Display(tPicture_Processor_8* pp);
+      virtual void Update_Display(tPicture_Processor_16* pp);
       void Load(std::string name, cArray<tObject>& objects);
       void Save(std::string name, cArray<tObject>& objects);
       void Load(std::string name, cMatrix& matrix);
       void Save(std::string name, cMatrix& matrix);
+      void Load_Binary(std::string name, cArray<tObject>& objects);
+      void Save_Binary(std::string name, cArray<tObject>& objects);
+      void Save_Binary(std::string name, cArray<tObject>& objects, bool use_dictionary);
+      void Convert_To_Binary(std::string text_name, std::string binary_name);
       int Get_Random_Number(int lower, int upper);
       virtual int Get_Text_Width(std::string text);
       virtual int Get_Text_Height(std::string text);
@@ -322,11 +816,16 @@ namespace Nerd {
   class cFile {
 
     public:
-      cArray<std::string> lines;
+      std::string data;
+      cVector<sLine_Span> spans;
       std::string name;
       int pointer;
 
       cFile(std::string name);
+      cFile(const cFile& other);
+      cFile(cFile&& other);
+      cFile& operator=(const cFile& other);
+      cFile& operator=(cFile&& other);
       void Read();
       void Write();
       void Add(std::string line);
@@ -335,6 +834,7 @@ namespace Nerd {
       void Remove(int index);
       int Count();
       std::string operator[](int index);
+      std::string_view View_Line(int index);
       std::string Get_Line();
       void operator>>(int& number);
       void operator>>=(tObject& object);
@@ -343,6 +843,85 @@ namespace Nerd {
 
   };
 
+  class cFile_Reader {
+
+    public:
+      enum Settings {
+        BUFFER_SIZE = 65536
+      };
+
+      std::ifstream file;
+      std::string name;
+      char* buffer;
+      int capacity;
+      int start;
+      int end;
+      int line_start;
+      int line_length;
+      bool has_line;
+      bool skip_new_line;
+      bool at_end;
+
+      cFile_Reader(std::string name);
+      ~cFile_Reader();
+      std::string Get_Line();
+      std::string_view View_Line();
+      void operator>>(int& number);
+      void operator>>=(tObject& object);
+      bool Has_More_Lines();
+      bool Find_Line();
+      void Fill_Buffer();
+
+  };
+
+  class cByte_Reader {
+
+    public:
+      const char* data;
+      int size;
+      int pointer;
+
+      cByte_Reader(const char* data, int size);
+      unsigned char Read_Byte();
+      int Read_Int32();
+      std::string_view Read_Bytes(int count);
+      std::string_view Read_Text();
+      bool Has_More_Bytes();
+
+  };
+
+  class cFile_Writer {
+
+    public:
+      enum Settings {
+        BUFFER_SIZE = 65536
+      };
+
+      std::ofstream file;
+      std::string name;
+      std::string temp_name;
+      char* buffer;
+      int pointer;
+      bool atomic;
+      bool closed;
+
+      cFile_Writer(std::string name);
+      cFile_Writer(std::string name, bool atomic);
+      ~cFile_Writer();
+      void Open(std::string name, bool atomic);
+      void Write_Text(std::string_view text);
+      void Write_Letter(char letter);
+      void Write_Number(int number);
+      void Write_Int32(int number);
+      void Write_Bytes(std::string_view bytes);
+      void Write_Line(std::string_view line);
+      void Write_Object(tObject& object);
+      void End_Line();
+      void Flush();
+      void Close();
+
+  };
+
   class cConfig {
 
     public:
@@ -367,7 +946,7 @@ namespace Nerd {
       cArray<tLine> lines;
       cIO_Control* io;
       int status;
-      cArray<int> input_buffer;
+      cDeque<int> input_buffer;
       int counter;
       std::chrono::time_point<std::chrono::system_clock> time_stamp;
       int scroll_x;
@@ -442,10 +1021,26 @@ namespace Nerd {
 
   };
 
+  class cComponent_Store {
+
+    public:
+      cVector<int> x;
+      cVector<int> y;
+      cVector<int> width;
+      cVector<int> height;
+
+      void Add(tObject& entity);
+      void Clear();
+      int Count();
+      int Find_Component(sPoint point, int cell_w, int cell_h);
+
+  };
+
   class cLayout {
 
     public:
       cHash<std::string, tObject> components;
+      cComponent_Store store;
       std::string sel_component;
       std::string clicked;
       int width;
@@ -473,6 +1068,7 @@ namespace Nerd {
       void Parse_Panel(tObject& entity);
       void Parse_Button(tObject& entity);
       void Parse_Properties(cFile& file);
+      void Compile_Components();
       void Render();
       virtual void On_Component_Init(tObject& entity);
       virtual void On_Component_Render(tObject& entity);
@@ -532,13 +1128,42 @@ namespace Nerd {
 
   };
 
+  cAtom_Table& Get_Atom_Table();
+  cWorker_Pool& Get_Worker_Pool();
+  eAtom Intern_Atom(const std::string& name);
+  std::string& Get_Atom_Name(eAtom atom);
   cArray<std::string> Parse_Sausage_Text(std::string text, std::string delimiter);
-  int Text_To_Number(std::string text);
+  eNumber_Status Try_Text_To_Number(std::string_view text, int& number);
+  int Text_To_Number(std::string_view text);
   std::string Number_To_Text(int number);
+  void Parse_Object_Field(std::string_view line, tObject& object);
+  void Read_File_Data(std::string name, std::string& data);
+  bool Is_Little_Endian();
+  int Get_Aligned_Stride(int width, int cell_size);
+  void* Allocate_Buffer(std::size_t size);
+  void Free_Buffer(void* buffer);
+  int Read_Table_Header(const char* data, std::size_t size, std::string name, int& width, int& height, int& cell_size);
+  sRectangle Merge_Rectangles(sRectangle first, sRectangle second);
+  long long Get_Rectangle_Area(sRectangle rect);
+  int Floor_Divide(int value, int divisor);
+  int Detect_SIMD_Level();
+  int& Get_SIMD_Setting();
+  int Get_SIMD_Level();
+  void Set_SIMD_Level(int level);
+  template <typename T> void Blend_Row(T* target, const T* source, int count, bool reverse);
+  template <typename T> void Convert_Row(unsigned int* target, const T* source, int count, const unsigned int* lut);
+#if NERD_SIMD
+  template <typename T> NERD_TARGET_AVX2 int Convert_Row_AVX2(unsigned int* target, const T* source, int count, const unsigned int* lut);
+  template <typename T> int Blend_Row_SSE2(T* target, const T* source, int count, bool reverse);
+  template <typename T> NERD_TARGET_AVX2 int Blend_Row_AVX2(T* target, const T* source, int count, bool reverse);
+#endif
+  int Format_Number(int number, char* buffer);
+  void Append_Number(std::string& text, int number);
   cArray<std::string> Parse_C_Lesh_Line(std::string line);
   std::string C_Lesh_String_To_Cpp_String(std::string text);
   bool Is_Point_In_Box(sPoint point, sRectangle box);
   std::string Join(cArray<std::string>& tokens, std::string glue);
   void Check_Condition(bool condition, std::string message);
+  void Check_Condition(bool condition, const char* message);
 
 }
\ No newline at end of file
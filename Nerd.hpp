@@ -36,14 +36,30 @@ namespace Nerd {
     this->Copy(other);
   }
 
+  /**
+   * Takes over the blocks of another array. The other array is left empty.
+   * @param other The other array.
+   */
+  template <typename T> cArray<T>::cArray(cArray<T>&& other) {
+    this->items = other.items;
+    this->pointer = other.pointer;
+    this->block_count = other.block_count;
+    this->table_size = other.table_size;
+    other.items = NULL;
+    other.pointer = 0;
+    other.block_count = 0;
+    other.table_size = 0;
+  }
+
   /**
    * Assigns another array to this one.
    * @param other The other array.
    * @return This array.
    */
   template <typename T> cArray<T>& cArray<T>::operator= (cArray<T>& other) {
-    this->Init();
-    this->Copy(other);
+    if (this != &other) {
+      this->Copy(other);
+    }
     return *this;
   }
 
@@ -53,8 +69,22 @@ namespace Nerd {
    * @return This array.
    */
   template <typename T> cArray<T>& cArray<T>::operator= (const cArray<T>& other) {
-    this->Init();
-    this->Copy(other);
+    if (this != &other) {
+      this->Copy(other);
+    }
+    return *this;
+  }
+
+  /**
+   * Swaps blocks with another array that is about to go away.
+   * @param other The other array.
+   * @return This array.
+   */
+  template <typename T> cArray<T>& cArray<T>::operator= (cArray<T>&& other) {
+    std::swap(this->items, other.items);
+    std::swap(this->pointer, other.pointer);
+    std::swap(this->block_count, other.block_count);
+    std::swap(this->table_size, other.table_size);
     return *this;
   }
 
@@ -70,12 +100,16 @@ namespace Nerd {
    * @param item The item.
    * @throws An error if we ran out of space.
    */
-  template <typename T> void cArray<T>::Add(T item) {
-    int size = this->Get_Size();
-    if (this->pointer == size) { // Ran out of space?
-      this->Alloc_Block();
-    }
-    (*this)[this->pointer++] = item;
+  template <typename T> void cArray<T>::Add(const T& item) {
+    this->Add() = item;
+  }
+
+  /**
+   * Moves an item into the array.
+   * @param item The item.
+   */
+  template <typename T> void cArray<T>::Add(T&& item) {
+    this->Add() = std::move(item);
   }
 
   /**
@@ -96,9 +130,9 @@ namespace Nerd {
    * @return The item that was removed.
    */
   template <typename T> T cArray<T>::Remove(int index) {
-    T item = (*this)[index];
+    T item = std::move((*this)[index]);
     for (int item_index = index + 1; item_index < this->pointer; item_index++) {
-      (*this)[item_index - 1] = (*this)[item_index];
+      (*this)[item_index - 1] = std::move((*this)[item_index]);
     }
     this->pointer--;
     return item;
@@ -108,10 +142,18 @@ namespace Nerd {
    * Pushes an item onto the back of an array.
    * @param item The item to push.
    */
-  template <typename T> void cArray<T>::Push(T item) {
+  template <typename T> void cArray<T>::Push(const T& item) {
     this->Add(item);
   }
 
+  /**
+   * Moves an item onto the back of an array.
+   * @param item The item to push.
+   */
+  template <typename T> void cArray<T>::Push(T&& item) {
+    this->Add(std::move(item));
+  }
+
   /**
    * Removes an item from the back of the array.
    * @return The item removed.
@@ -132,9 +174,9 @@ namespace Nerd {
     // Shift everything over to make space.
     this->pointer++; // Increase size.
     for (int item_index = this->pointer - 1; item_index > 0; item_index--) {
-      (*this)[item_index] = (*this)[item_index - 1];
+      (*this)[item_index] = std::move((*this)[item_index - 1]);
     }
-    (*this)[0] = item;
+    (*this)[0] = std::move(item);
   }
 
   /**
@@ -158,9 +200,9 @@ namespace Nerd {
     }
     this->pointer++;
     for (int item_index = this->pointer - 1; item_index > index; item_index--) {
-      (*this)[item_index] = (*this)[item_index - 1];
+      (*this)[item_index] = std::move((*this)[item_index - 1]);
     }
-    (*this)[index] = item;
+    (*this)[index] = std::move(item);
   }
 
   /**
@@ -203,18 +245,7 @@ namespace Nerd {
    * @param source The source array.
    */
   template <typename T> void cArray<T>::Copy(cArray<T>& other) {
-    T** table = new T* [other.table_size];
-    for (int entry_index = 0; entry_index < other.block_count; entry_index++) {
-      table[entry_index] = new T[BLOCK_SIZE];
-      for (int item_index = 0; item_index < BLOCK_SIZE; item_index++) {
-        table[entry_index][item_index] = other.items[entry_index][item_index];
-      }
-    }
-    this->Free();
-    this->items = table;
-    this->table_size = other.table_size;
-    this->block_count = other.block_count;
-    this->pointer = other.pointer;
+    this->Copy(static_cast<const cArray<T>&>(other));
   }
 
   /**
@@ -225,7 +256,12 @@ namespace Nerd {
     T** table = new T* [other.table_size];
     for (int entry_index = 0; entry_index < other.block_count; entry_index++) {
       table[entry_index] = new T[BLOCK_SIZE];
-      for (int item_index = 0; item_index < BLOCK_SIZE; item_index++) {
+      // Only live items need to be copied.
+      int item_count = other.pointer - (entry_index * BLOCK_SIZE);
+      if (item_count > BLOCK_SIZE) {
+        item_count = BLOCK_SIZE;
+      }
+      for (int item_index = 0; item_index < item_count; item_index++) {
         table[entry_index][item_index] = other.items[entry_index][item_index];
       }
     }
@@ -243,12 +279,78 @@ namespace Nerd {
    * @throws An error if the index is not valid.
    */
   template <typename T> T& cArray<T>::operator[] (int index) {
-    Check_Condition(((index >= 0) && (index < this->pointer)), "Index is out of bounds.");
+#if NERD_BOUNDS_CHECK
+    if ((index < 0) || (index >= this->pointer)) {
+      throw cError("Index is out of bounds.");
+    }
+#endif
     int item_index = index % BLOCK_SIZE;
     int block_index = index / BLOCK_SIZE;
     return this->items[block_index][item_index];
   }
 
+  /**
+   * Accesses an item from the array without checking the index. Use only
+   * when the index is already known to be valid.
+   * @param index The index of the item.
+   * @return The item.
+   */
+  template <typename T> T& cArray<T>::At_Unchecked(int index) {
+    return this->items[index / BLOCK_SIZE][index % BLOCK_SIZE];
+  }
+
+  /**
+   * Gets an iterator to the first item of the array.
+   * @return The iterator.
+   */
+  template <typename T> typename cArray<T>::cIterator cArray<T>::begin() {
+    return cIterator(this->items, 0);
+  }
+
+  /**
+   * Gets an iterator past the last item of the array.
+   * @return The iterator.
+   */
+  template <typename T> typename cArray<T>::cIterator cArray<T>::end() {
+    return cIterator(this->items, this->pointer);
+  }
+
+  /**
+   * Creates an iterator over the blocks of an array.
+   * @param items The block table.
+   * @param index The index of the item the iterator points to.
+   */
+  template <typename T> cArray<T>::cIterator::cIterator(T** items, int index) {
+    this->items = items;
+    this->index = index;
+  }
+
+  /**
+   * Accesses the item the iterator points to.
+   * @return The item.
+   */
+  template <typename T> T& cArray<T>::cIterator::operator* () {
+    return this->items[this->index / BLOCK_SIZE][this->index % BLOCK_SIZE];
+  }
+
+  /**
+   * Moves the iterator to the next item.
+   * @return This iterator.
+   */
+  template <typename T> typename cArray<T>::cIterator& cArray<T>::cIterator::operator++ () {
+    this->index++;
+    return (*this);
+  }
+
+  /**
+   * Determines if two iterators point to different items.
+   * @param other The other iterator.
+   * @return True if the iterators differ, false otherwise.
+   */
+  template <typename T> bool cArray<T>::cIterator::operator!= (const cIterator& other) {
+    return (this->index != other.index);
+  }
+
   /**
    * Prints out the array contents.
    */
@@ -313,1204 +415,3029 @@ namespace Nerd {
   }
 
   // **************************************************************************
-  // Hash Implementation
+  // Vector Implementation
   // **************************************************************************
 
   /**
-   * Adds a new key/value pair.
-   * @param key The key value.
-   * @param value The value.
+   * Creates a new empty vector. No storage is allocated until the first item is added.
    */
-  template <typename K, typename V> void cHash<K, V>::Add(K key, V value) {
-    // Look for key.
-    int hash_key = this->Get_Hash_Key(key);
-    if (hash_key == NO_VALUE_FOUND) {
-      this->keys.Add(key);
-      this->values.Add(value);
-    }
-    else {
-      this->values[hash_key] = value;
-    }
+  template <typename T> cVector<T>::cVector() {
+    this->items = NULL;
+    this->pointer = 0;
+    this->capacity = 0;
   }
 
   /**
-   * Removes a key/value pair from the hash.
-   * @param key The key to match to the pair.
-   * @throws An error if the pair does not exist.
+   * Copies another vector to this one.
+   * @param other The other vector.
    */
-  template <typename K, typename V> void cHash<K, V>::Remove(K key) {
-    int hash_key = this->Get_Hash_Key(key);
-    if (hash_key == NO_VALUE_FOUND) {
-      throw cError("Key was not found!");
-    }
-    else {
-      this->keys.Remove(hash_key);
-      this->values.Remove(hash_key);
-    }
+  template <typename T> cVector<T>::cVector(const cVector<T>& other) {
+    this->items = NULL;
+    this->pointer = 0;
+    this->capacity = 0;
+    this->Copy(other);
   }
 
   /**
-   * Retrieves a value given a key.
-   * @param key The key associated with the value.
-   * @return The value associated with the key.
+   * Takes over the storage of another vector. The other vector is left empty.
+   * @param other The other vector.
    */
-  template <typename K, typename V> V& cHash<K, V>::operator[](K key) {
-    int hash_key = this->Get_Hash_Key(key);
-    if (hash_key == NO_VALUE_FOUND) {
-      V value{}; // Initialize default value.
-      this->Add(key, value);
-      hash_key = this->keys.Count() - 1;
-    }
-    return this->values[hash_key];
+  template <typename T> cVector<T>::cVector(cVector<T>&& other) {
+    this->items = other.items;
+    this->pointer = other.pointer;
+    this->capacity = other.capacity;
+    other.items = NULL;
+    other.pointer = 0;
+    other.capacity = 0;
   }
 
   /**
-   * Gets the index key associated with the key of the hash.
-   * @param key The key to lookup.
-   * @return The index of the key or NO_VALUE_FOUND if the key was not found.
+   * Frees the vector.
    */
-  template <typename K, typename V> int cHash<K, V>::Get_Hash_Key(K key) {
-    int count = this->keys.Count();
-    int hash_key = NO_VALUE_FOUND;
-    for (int key_index = 0; key_index < count; key_index++) {
-      if (this->keys[key_index] == key) {
-        hash_key = key_index;
-        break;
-      }
-    }
-    return hash_key;
+  template <typename T> cVector<T>::~cVector() {
+    this->Free();
   }
 
   /**
-   * Clears out the hash.
+   * Assigns another vector to this one.
+   * @param other The other vector.
+   * @return This vector.
    */
-  template <typename K, typename V> void cHash<K, V>::Clear() {
-    this->keys.Clear();
-    this->values.Clear();
+  template <typename T> cVector<T>& cVector<T>::operator= (const cVector<T>& other) {
+    if (this != &other) {
+      this->Copy(other);
+    }
+    return *this;
   }
 
   /**
-   * Gets the number of keys/values in the hash.
-   * @return The count of items.
+   * Swaps storage with another vector that is about to go away.
+   * @param other The other vector.
+   * @return This vector.
    */
-  template <typename K, typename V> int cHash<K, V>::Count() {
-    return this->keys.Count();
+  template <typename T> cVector<T>& cVector<T>::operator= (cVector<T>&& other) {
+    std::swap(this->items, other.items);
+    std::swap(this->pointer, other.pointer);
+    std::swap(this->capacity, other.capacity);
+    return *this;
   }
 
   /**
-   * Checks to see if a key exists.
-   * @param key The key.
-   * @return True if the key exists, false otherwise.
+   * Accesses an item from the vector.
+   * @param index The index of the item.
+   * @return The item.
+   * @throws An error if the index is not valid.
    */
-  template <typename K, typename V> bool cHash<K, V>::Does_Key_Exist(K key) {
-    int hash_key = this->Get_Hash_Key(key);
-    return (hash_key != NO_VALUE_FOUND);
+  template <typename T> T& cVector<T>::operator[] (int index) {
+#if NERD_BOUNDS_CHECK
+    if ((index < 0) || (index >= this->pointer)) {
+      throw cError("Index is out of bounds.");
+    }
+#endif
+    return this->items[index];
   }
 
-  // **************************************************************************
-  // Error Implementation
-  // **************************************************************************
-
   /**
-   * Initializes an error with a message.
-   * @param message The message to give the error.
+   * Accesses an item from the vector without checking the index. Use only
+   * when the index is already known to be valid.
+   * @param index The index of the item.
+   * @return The item.
    */
-  cError::cError(std::string message) {
-    this->message = message;
+  template <typename T> T& cVector<T>::At_Unchecked(int index) {
+    return this->items[index];
   }
 
   /**
-   * Prints an error to the console.
+   * Gets a pointer to the first item of the vector.
+   * @return The iterator.
    */
-  void cError::Print() {
-    std::cout << "Error: " << this->message << std::endl;
+  template <typename T> T* cVector<T>::begin() {
+    return this->items;
   }
 
-  // **************************************************************************
-  // File Implementation
-  // **************************************************************************
-
   /**
-   * Creates a new file object.
-   * @param name The name of the file.
+   * Gets a pointer past the last item of the vector.
+   * @return The iterator.
    */
-  cFile::cFile(std::string name) {
-    this->name = name;
-    this->pointer = 0;
+  template <typename T> T* cVector<T>::end() {
+    return this->items + this->pointer;
   }
 
   /**
-   * Reads a file from disk.
-   * @throws An error if something went wrong.
+   * Adds an item to the end of the vector. Storage doubles when it runs out.
+   * @param item The item.
    */
-  void cFile::Read() {
-    std::ifstream file(this->name, std::ios::binary);
-    if (file) {
-      this->Clear(); // Clear out lines.
-      file.seekg(0, std::ios::end);
-      int size = file.tellg();
-      file.seekg(0);
-      std::string line = "";
-      bool new_line_read = false;
-      for (int byte_index = 0; byte_index < size; byte_index++) {
-        char letter = 0;
-        file.get(letter);
-        if (file.good()) {
-          if (letter == '\r') { // Windows/Mac
-            this->lines.Add(line);
-            line = "";
-            new_line_read = true;
-          }
-          else if (letter == '\n') { // Unix/Linux
-            if (!new_line_read) {
-              this->lines.Add(line);
-              line = "";
-            }
-            new_line_read = false;
-          }
-          else {
-            line += letter;
-          }
-        }
-        else {
-          throw cError("Problem reading file " + this->name + ".");
-        }
-      }
-      // Add the last line.
-      if (line.length() > 0) {
-        this->lines.Add(line);
-      }
+  template <typename T> void cVector<T>::Add(const T& item) {
+    if (this->pointer == this->capacity) { // Ran out of space?
+      T copy = item; // The item could live in this vector.
+      this->Grow();
+      this->items[this->pointer++] = std::move(copy);
     }
     else {
-      throw cError("Could not read file " + this->name + ".");
+      this->items[this->pointer++] = item;
     }
   }
 
   /**
-   * Writes the file to disk.
-   * @throws An error if the file could not be saved.
+   * Moves an item to the end of the vector.
+   * @param item The item.
    */
-  void cFile::Write() {
-    std::ofstream file(this->name, std::ios::binary);
-    if (file) {
-      int line_count = this->lines.Count();
-      for (int line_index = 0; line_index < line_count; line_index++) {
-        int letter_count = this->lines[line_index].length();
-        for (int letter_index = 0; letter_index < letter_count; letter_index++) {
-          file << this->lines[line_index][letter_index];
-        }
-        file << '\n';
-      }
+  template <typename T> void cVector<T>::Add(T&& item) {
+    if (this->pointer == this->capacity) { // Ran out of space?
+      T copy = std::move(item); // The item could live in this vector.
+      this->Grow();
+      this->items[this->pointer++] = std::move(copy);
     }
     else {
-      throw cError("Could not write file " + this->name + ".");
+      this->items[this->pointer++] = std::move(item);
     }
   }
 
   /**
-   * Adds a line to the file.
-   * @param line The line to add.
+   * Extends the vector by one item. The item is not initialized.
+   * @return The reference to the item inside the vector.
    */
-  void cFile::Add(std::string line) {
-    this->lines.Add(line);
+  template <typename T> T& cVector<T>::Add() {
+    if (this->pointer == this->capacity) { // Ran out of space?
+      this->Grow();
+    }
+    return this->items[this->pointer++];
   }
 
   /**
-   * Adds a number to the file.
-   * @param number The number to add.
+   * Removes an item from the vector.
+   * @param index The index of the item to remove.
+   * @return The item that was removed.
+   * @throws An error if the index is not valid.
    */
-  void cFile::Add(int number) {
-    this->lines.Add(Number_To_Text(number));
+  template <typename T> T cVector<T>::Remove(int index) {
+    T item = std::move((*this)[index]);
+    for (int item_index = index + 1; item_index < this->pointer; item_index++) {
+      this->items[item_index - 1] = std::move(this->items[item_index]);
+    }
+    this->pointer--;
+    return item;
   }
 
   /**
-   * Adds an object to the file.
-   * @param object The object to add to the file.
+   * Pushes an item onto the back of the vector.
+   * @param item The item to push.
    */
-  void cFile::Add(tObject& object) {
-    int field_count = object.Count();
-    this->Add("object");
-    for (int field_index = 0; field_index < field_count; field_index++) {
-      std::string name = object.keys[field_index];
-      if (object.values[field_index].type == eVALUE_NUMBER) {
-        this->Add(name + "=" + Number_To_Text(object.values[field_index].number));
-      }
-      else if (object.values[field_index].type == eVALUE_STRING) {
-        this->Add(name + "=" + object.values[field_index].string);
-      }
-    }
-    this->Add("end");
+  template <typename T> void cVector<T>::Push(const T& item) {
+    this->Add(item);
   }
 
   /**
-   * Removes a line at a specified index.
-   * @param index The index of the line to remove.
-   * @throws An error if the index is not valid.
+   * Moves an item onto the back of the vector.
+   * @param item The item to push.
    */
-  void cFile::Remove(int index) {
-    this->lines.Remove(index);
+  template <typename T> void cVector<T>::Push(T&& item) {
+    this->Add(std::move(item));
   }
 
   /**
-   * Gets the number of lines in the file.
-   * @return The number of lines in the file.
+   * Removes an item from the back of the vector.
+   * @return The item removed.
    */
-  int cFile::Count() {
-    return this->lines.Count();
+  template <typename T> T cVector<T>::Pop() {
+    return this->Remove(this->pointer - 1);
   }
 
   /**
-   * Gets the string at the index.
-   * @param index The index of the string.
-   * @return The string at the index.
-   * @throws An error if the string is not present.
+   * Adds an item to the front of the vector.
+   * @param item The item to add.
    */
-  std::string cFile::operator[](int index) {
-    return this->lines[index];
+  template <typename T> void cVector<T>::Unshift(T item) {
+    this->Insert(std::move(item), 0);
   }
 
   /**
-   * Gets a line from the file sequentially.
-   * @return The read line.
-   * @throws An error if no more lines can be read.
+   * Removes an item from the front of the vector.
+   * @return The item in the front of the vector.
    */
-  std::string cFile::Get_Line() {
-    Check_Condition(this->Has_More_Lines(), "No more lines to read.");
-    return this->lines[this->pointer++];
+  template <typename T> T cVector<T>::Shift() {
+    return this->Remove(0);
   }
 
   /**
-   * Reads a numeric value from an index.
-   * @param number The number to read.
-   * @throws An error if the number could not be read.
+   * Inserts an item at the specified index into the vector.
+   * @param item The item to insert.
+   * @param index The index to insert the item before.
+   * @throws An error if the index is invalid.
    */
-  void cFile::operator>>(int& number) {
-    Check_Condition(this->Has_More_Lines(), "No more lines to read.");
-    number = Text_To_Number(this->lines[this->pointer++]);
+  template <typename T> void cVector<T>::Insert(T item, int index) {
+    Check_Condition(((index >= 0) && (index <= this->pointer)), "Index is out of bounds.");
+    if (this->pointer == this->capacity) { // Ran out of space?
+      this->Grow();
+    }
+    for (int item_index = this->pointer; item_index > index; item_index--) {
+      this->items[item_index] = std::move(this->items[item_index - 1]);
+    }
+    this->items[index] = std::move(item);
+    this->pointer++;
   }
 
   /**
-   * Reads an object from the file.
-   * @param object The object to read in.
-   * @throws An error if the object could not be read.
+   * Gets the number of items in the vector.
+   * @return The number of items in the vector.
    */
-  void cFile::operator>>=(tObject& object) {
-    Check_Condition(this->Has_More_Lines(), "No more lines to read.");
-    std::string line = this->lines[this->pointer++];
-    if (line != "object") {
-      throw cError("Object identifier missing.");
-    }
-    while (line != "end") {
-      Check_Condition(this->Has_More_Lines(), "No more lines to read.");
-      line = this->lines[this->pointer++];
-      cArray<std::string> pair = Parse_Sausage_Text(line, "=");
-      if (pair.Count() == 2) {
-        std::string name = pair[0];
-        std::string value = pair[1];
-        try {
-          object[name] = cValue(Text_To_Number(value));
-        }
-        catch (cError number_error) {
-          object[name] = cValue(value);
-        }
-      }
-    }
+  template <typename T> int cVector<T>::Count() {
+    return this->pointer;
   }
 
   /**
-   * Clears out the file's lines.
+   * Doubles the capacity of the vector.
    */
-  void cFile::Clear() {
-    this->lines.Clear();
-    this->pointer = 0;
+  template <typename T> void cVector<T>::Grow() {
+    int size = (this->capacity > 0) ? this->capacity * 2 : MIN_CAPACITY;
+    this->Reserve(size);
   }
 
   /**
-   * Determines if a file has more lines.
-   * @return True if there are more lines, false otherwise.
+   * Makes sure the vector can hold at least a number of items without reallocating.
+   * @param size The number of items to make room for.
    */
-  bool cFile::Has_More_Lines() {
-    return (this->pointer < this->lines.Count());
+  template <typename T> void cVector<T>::Reserve(int size) {
+    if (size > this->capacity) {
+      T* table = new T[size];
+      for (int item_index = 0; item_index < this->pointer; item_index++) {
+        table[item_index] = std::move(this->items[item_index]);
+      }
+      this->Free();
+      this->items = table;
+      this->capacity = size;
+    }
   }
 
-  // **************************************************************************
-  // Config Module Implementation
-  // **************************************************************************
-
   /**
-   * Creates a new config file.
-   * @param name The name of the config file.
-   * @throws An error if the config file could not be loaded.
+   * Releases any storage that is not used by items.
    */
-  cConfig::cConfig(std::string name) {
-    cFile config_file(name + ".txt");
-    config_file.Read();
-    int line_count = config_file.Count();
-    for (int line_index = 0; line_index < line_count; line_index++) {
-      std::string line = config_file.lines[line_index];
-      cArray<std::string> pair = Parse_Sausage_Text(line, "=");
-      if (pair.Count() == 2) {
-        std::string name = pair[0];
-        cValue value;
-        try {
-          value.Set_Number(Text_To_Number(pair[1]));
-        }
-        catch (cError number_error) {
-          value.Set_String(pair[1]);
+  template <typename T> void cVector<T>::Shrink_To_Fit() {
+    if (this->pointer < this->capacity) {
+      T* table = NULL;
+      if (this->pointer > 0) {
+        table = new T[this->pointer];
+        for (int item_index = 0; item_index < this->pointer; item_index++) {
+          table[item_index] = std::move(this->items[item_index]);
         }
-        this->config[name] = value;
       }
+      this->Free();
+      this->items = table;
+      this->capacity = this->pointer;
     }
   }
 
   /**
-   * Gets a numeric property value.
-   * @param name The name of the property.
-   * @return The value of the property.
-   * @throws An error if the property does not exist.
+   * Copies the items of another vector.
+   * @param other The other vector.
    */
-  int cConfig::Get_Property(std::string name) {
-    if (!this->config.Does_Key_Exist(name)) {
-      throw Nerd::cError("Property value " + name + " does not exist.");
+  template <typename T> void cVector<T>::Copy(const cVector<T>& other) {
+    T* table = NULL;
+    if (other.pointer > 0) {
+      table = new T[other.pointer];
+      for (int item_index = 0; item_index < other.pointer; item_index++) {
+        table[item_index] = other.items[item_index];
+      }
     }
-    return this->config[name].number;
+    this->Free();
+    this->items = table;
+    this->capacity = other.pointer;
+    this->pointer = other.pointer;
   }
 
   /**
-   * Gets a string property value.
-   * @param name The name of the property.
-   * @return The value of the property. 
-   * @throws An error if the property does not exist.
+   * Gets the raw item storage. Items are contiguous in memory.
+   * @return The pointer to the first item or NULL if nothing was allocated.
    */
-  std::string cConfig::Get_Text_Property(std::string name) {
-    Check_Condition(this->config.Does_Key_Exist(name), "Property value " + name + " does not exist.");
-    return this->config[name].string;
+  template <typename T> T* cVector<T>::Data() {
+    return this->items;
   }
 
-  // **************************************************************************
-  // Value Implementation
-  // **************************************************************************
-
   /**
-   * Creates a new value.
+   * Frees the item storage.
    */
-  cValue::cValue() {
-    this->Set_Number(0);
+  template <typename T> void cVector<T>::Free() {
+    if (this->items) {
+      delete[] this->items;
+      this->items = NULL;
+    }
   }
 
   /**
-   * Create a numeric value.
-   * @param number The numeric value.
+   * Gets the max size of the vector before it has to grow.
+   * @return The capacity of the vector in items.
    */
-  cValue::cValue(int number) {
-    this->Set_Number(number);
-    this->string = Number_To_Text(number); // Also set string value.
+  template <typename T> int cVector<T>::Get_Size() {
+    return this->capacity;
   }
 
   /**
-   * Creates a string value.
-   * @param string The string value.
+   * Clears out the vector. Storage is kept for reuse.
    */
-  cValue::cValue(std::string string) {
-    this->Set_String(string);
-    try {
-      this->number = Text_To_Number(string);
-    }
-    catch (cError number_error) {
-      this->number = 0;
-    }
+  template <typename T> void cVector<T>::Clear() {
+    this->pointer = 0;
   }
 
   /**
-   * Sets a numeric value.
-   * @param number The number.
+   * Accesses an item from the front of the vector.
+   * @return The item on the front.
    */
-  void cValue::Set_Number(int number) {
-    this->type = eVALUE_NUMBER;
-    this->number = number;
+  template <typename T> T& cVector<T>::Peek_Front() {
+    return (*this)[0];
   }
 
   /**
-   * Sets a string value.
-   * @param string The string value.
+   * Accesses an item from the back of the vector.
+   * @return The item on the back.
    */
-  void cValue::Set_String(std::string string) {
-    this->type = eVALUE_STRING;
-    this->string = string;
+  template <typename T> T& cVector<T>::Peek_Back() {
+    return (*this)[this->pointer - 1];
   }
 
+  // **************************************************************************
+  // Deque Implementation
+  // **************************************************************************
+
   /**
-   * Copies another value to this value.
-   * @param other The other value.
+   * Creates a new empty deque. No storage is allocated until the first item is added.
    */
-  cValue& cValue::operator=(const cValue& other) {
-    this->type = other.type;
-    this->number = other.number;
-    this->string = other.string;
-    return (*this);
+  template <typename T> cDeque<T>::cDeque() {
+    this->items = NULL;
+    this->head = 0;
+    this->pointer = 0;
+    this->capacity = 0;
   }
 
   /**
-   * Assigns a numeric value.
-   * @param number The numeric value.
+   * Copies another deque to this one.
+   * @param other The other deque.
    */
-  void cValue::operator=(const int number) {
-    this->Set_Number(number);
+  template <typename T> cDeque<T>::cDeque(const cDeque<T>& other) {
+    this->items = NULL;
+    this->head = 0;
+    this->pointer = 0;
+    this->capacity = 0;
+    this->Copy(other);
   }
 
   /**
-   * Assigns a string value. It can be numeric which will convert it to a number.
-   * @param string The string value.
+   * Takes over the storage of another deque. The other deque is left empty.
+   * @param other The other deque.
    */
-  void cValue::operator=(const std::string string) {
-    try {
-      this->Set_Number(Text_To_Number(string)); // Try to convert to number.
-    }
-    catch (cError number_error) {
-      this->Set_String(string);
-    }
+  template <typename T> cDeque<T>::cDeque(cDeque<T>&& other) {
+    this->items = other.items;
+    this->head = other.head;
+    this->pointer = other.pointer;
+    this->capacity = other.capacity;
+    other.items = NULL;
+    other.head = 0;
+    other.pointer = 0;
+    other.capacity = 0;
   }
 
   /**
-   * Converts the value to numeric form.
+   * Frees the deque.
    */
-  void cValue::Convert_To_Number() {
-    this->number = Text_To_Number(this->string);
+  template <typename T> cDeque<T>::~cDeque() {
+    this->Free();
   }
 
   /**
-   * Converts the value to a string.
+   * Assigns another deque to this one.
+   * @param other The other deque.
+   * @return This deque.
    */
-  void cValue::Convert_To_String() {
-    this->string = Number_To_Text(this->number);
+  template <typename T> cDeque<T>& cDeque<T>::operator= (const cDeque<T>& other) {
+    if (this != &other) {
+      this->Copy(other);
+    }
+    return *this;
   }
 
-  // **************************************************************************
-  // I/O Control Implementation
-  // **************************************************************************
-
   /**
-   * Initializes the I/O control.
+   * Swaps storage with another deque that is about to go away.
+   * @param other The other deque.
+   * @return This deque.
    */
-  cIO_Control::cIO_Control() {
-    std::srand(std::time(NULL));
-    this->use_canvas = false;
-    this->width = 400;
-    this->height = 300;
+  template <typename T> cDeque<T>& cDeque<T>::operator= (cDeque<T>&& other) {
+    std::swap(this->items, other.items);
+    std::swap(this->head, other.head);
+    std::swap(this->pointer, other.pointer);
+    std::swap(this->capacity, other.capacity);
+    return *this;
   }
 
   /**
-   * Reads a signal from the signal buffer.
-   * @return The signal from the signal buffer.
+   * Accesses an item from the deque. Index zero is the front.
+   * @param index The index of the item.
+   * @return The item.
+   * @throws An error if the index is not valid.
    */
-  sSignal cIO_Control::Read_Signal() {
-    sSignal signal = { eSIGNAL_NONE, 0, 0, eBUTTON_NONE };
-    if (this->signal_buffer.Count() > 0) {
-      signal = this->signal_buffer.Shift();
+  template <typename T> T& cDeque<T>::operator[] (int index) {
+#if NERD_BOUNDS_CHECK
+    if ((index < 0) || (index >= this->pointer)) {
+      throw cError("Index is out of bounds.");
     }
-    return signal;
+#endif
+    return this->items[(this->head + index) & (this->capacity - 1)];
   }
 
   /**
-   * Reads a key from the buffer. Leaves any other signals in.
-   * @return The read key or nothing.
+   * Accesses an item from the deque without checking the index.
+   * @param index The index of the item.
+   * @return The item.
    */
-  sSignal cIO_Control::Read_Key() {
-    sSignal signal = { eSIGNAL_NONE, 0, 0, eBUTTON_NONE };
-    // Find a key signal.
-    int signal_count = this->signal_buffer.Count();
-    for (int signal_index = signal_count - 1; signal_index >= 0; signal_index--) { // Back to front.
-      if (this->signal_buffer[signal_index].code != eSIGNAL_MOUSE) {
-        signal = this->signal_buffer.Remove(signal_index);
-        break;
-      }
-    }
-    return signal;
+  template <typename T> T& cDeque<T>::At_Unchecked(int index) {
+    return this->items[(this->head + index) & (this->capacity - 1)];
   }
 
   /**
-   * Adds a key signal to the buffer.
-   * @param key The key to add.
+   * Pushes an item onto the back of the deque.
+   * @param item The item to push.
    */
-  void cIO_Control::Add_Key(int key) {
-    this->signal_buffer.Push({ key, 0, 0, eBUTTON_NONE });
+  template <typename T> void cDeque<T>::Push(const T& item) {
+    this->Push(T(item));
   }
 
   /**
-   * Adds a mouse signal.
-   * @param button The pressed button or none.
-   * @param x The mouse x coordinate.
-   * @param y The mouse y coordinate.
+   * Moves an item onto the back of the deque.
+   * @param item The item to push.
    */
-  void cIO_Control::Add_Mouse(int button, int x, int y) {
-    // std::cout << "button=" << button << ", x=" << x << ", y=" << y << std::endl;
-    this->signal_buffer.Push({ eSIGNAL_MOUSE, { x, y }, button});
+  template <typename T> void cDeque<T>::Push(T&& item) {
+    if (this->pointer == this->capacity) { // Ran out of space?
+      T copy = std::move(item); // The item could live in this deque.
+      this->Grow();
+      this->items[(this->head + this->pointer) & (this->capacity - 1)] = std::move(copy);
+    }
+    else {
+      this->items[(this->head + this->pointer) & (this->capacity - 1)] = std::move(item);
+    }
+    this->pointer++;
   }
 
   /**
-   * Draws an image to the screen.
-   * @param name The name of the image.
-   * @param x The x coordinate.
-   * @param y The y coordinate.
-   * @param width The width of the image.
-   * @param height The height of the image.
-   * @param angle The angle in degrees.
-   * @param flip_x If set flips the image on the x-axis.
-   * @param flip_y If set flips the image on the y-axis.
+   * Removes an item from the back of the deque.
+   * @return The item removed.
+   * @throws An error if the deque is empty.
    */
-  void cIO_Control::Draw_Image(std::string name, int x, int y, int width, int height, int angle, bool flip_x, bool flip_y) {
-    // To be implemented in the app.
+  template <typename T> T cDeque<T>::Pop() {
+    Check_Condition((this->pointer > 0), "Deque is empty.");
+    this->pointer--;
+    return std::move(this->items[(this->head + this->pointer) & (this->capacity - 1)]);
   }
 
   /**
-   * Draws the background canvas to the screen.
-   * @param x The x coordinate.
-   * @param y The y coordinate.
-   * @param width The width of the clipping rectangle.
-   * @param height The height of the clipping rectangle.
+   * Adds an item to the front of the deque.
+   * @param item The item to add.
    */
-  void cIO_Control::Draw_Canvas(int x, int y, int width, int height) {
-    // To be implemented in the app.
+  template <typename T> void cDeque<T>::Unshift(const T& item) {
+    this->Unshift(T(item));
   }
 
   /**
-   * Outputs text to the screen.
-   * @param text The text to output.
-   * @param x The x coordinate.
-   * @param y The y coordinate.
-   * @param red The red component of the color.
-   * @param green The green component of the color.
-   * @param blue The blue component of the color.
+   * Moves an item to the front of the deque.
+   * @param item The item to add.
    */
-  void cIO_Control::Output_Text(std::string text, int x, int y, int red, int green, int blue) {
-    // To be implemented in the app.
+  template <typename T> void cDeque<T>::Unshift(T&& item) {
+    if (this->pointer == this->capacity) { // Ran out of space?
+      T copy = std::move(item); // The item could live in this deque.
+      this->Grow();
+      this->head = (this->head - 1) & (this->capacity - 1);
+      this->items[this->head] = std::move(copy);
+    }
+    else {
+      this->head = (this->head - 1) & (this->capacity - 1);
+      this->items[this->head] = std::move(item);
+    }
+    this->pointer++;
   }
 
   /**
-   * Draws a box.
-   * @param x The x coordinate.
-   * @param y The y coordinate.
-   * @param width The width of the box.
-   * @param height The height of the box.
-   * @param red The red component.
-   * @param green The green component.
-   * @param blue The blue component.
+   * Removes an item from the front of the deque.
+   * @return The item in the front of the deque.
+   * @throws An error if the deque is empty.
    */
-  void cIO_Control::Box(int x, int y, int width, int height, int red, int green, int blue) {
-    // To be implemented in the app.
+  template <typename T> T cDeque<T>::Shift() {
+    Check_Condition((this->pointer > 0), "Deque is empty.");
+    T item = std::move(this->items[this->head]);
+    this->head = (this->head + 1) & (this->capacity - 1);
+    this->pointer--;
+    return item;
   }
 
   /**
-   * Draw a frame.
-   * @param x The x coordinate.
-   * @param y The y coordinate.
-   * @param width The width of the box.
-   * @param height The height of the box.
-   * @param red The red component.
-   * @param green The green component.
-   * @param blue The blue component.
+   * Removes an item from anywhere in the deque. Items on the shorter side
+   * of the index are moved to close the gap.
+   * @param index The index of the item to remove.
+   * @return The item that was removed.
+   * @throws An error if the index is not valid.
    */
-  void cIO_Control::Frame(int x, int y, int width, int height, int red, int green, int blue) {
-    // To be implemented in app.
+  template <typename T> T cDeque<T>::Remove(int index) {
+    Check_Condition(((index >= 0) && (index < this->pointer)), "Index is out of bounds.");
+    T item = std::move(this->At_Unchecked(index));
+    if (index < (this->pointer / 2)) { // Close the gap from the front.
+      for (int item_index = index; item_index > 0; item_index--) {
+        this->At_Unchecked(item_index) = std::move(this->At_Unchecked(item_index - 1));
+      }
+      this->head = (this->head + 1) & (this->capacity - 1);
+    }
+    else { // Close the gap from the back.
+      for (int item_index = index + 1; item_index < this->pointer; item_index++) {
+        this->At_Unchecked(item_index - 1) = std::move(this->At_Unchecked(item_index));
+      }
+    }
+    this->pointer--;
+    return item;
   }
 
   /**
-   * Plays a sound.
-   * @param name The name of the sound.
+   * Gets the number of items in the deque.
+   * @return The number of items in the deque.
    */
-  void cIO_Control::Play_Sound(std::string name) {
-    // To be implemented in the app.
+  template <typename T> int cDeque<T>::Count() {
+    return this->pointer;
   }
 
   /**
-   * Plays a music track.
-   * @param name The name of the music track.
+   * Doubles the capacity of the deque.
    */
-  void cIO_Control::Play_Music(std::string name) {
-    // To be implemented in the app.
+  template <typename T> void cDeque<T>::Grow() {
+    int size = (this->capacity > 0) ? this->capacity * 2 : MIN_CAPACITY;
+    this->Reserve(size);
   }
 
   /**
-   * Turns off the sounds playing.
+   * Makes sure the deque can hold at least a number of items without
+   * reallocating. The capacity is kept at a power of two so indices wrap
+   * with a mask.
+   * @param size The number of items to make room for.
    */
-  void cIO_Control::Silence() {
-    // To be implemented in the app.
+  template <typename T> void cDeque<T>::Reserve(int size) {
+    if (size > this->capacity) {
+      int new_capacity = MIN_CAPACITY;
+      while (new_capacity < size) {
+        new_capacity *= 2;
+      }
+      T* table = new T[new_capacity];
+      for (int item_index = 0; item_index < this->pointer; item_index++) {
+        table[item_index] = std::move(this->At_Unchecked(item_index));
+      }
+      this->Free();
+      this->items = table;
+      this->head = 0;
+      this->capacity = new_capacity;
+    }
   }
 
   /**
-   * Delays execution for specified number of milliseconds.
-   * @param delay The number of milliseconds to delay execution.
+   * Copies the items of another deque.
+   * @param other The other deque.
    */
-  void cIO_Control::Timeout(int delay) {
-    auto start = std::chrono::system_clock::now();
-    bool done = false;
-    while (!done) {
-      auto end = std::chrono::system_clock::now();
-      auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
-      if (diff.count() >= delay) { // Time is up!
-        break;
+  template <typename T> void cDeque<T>::Copy(const cDeque<T>& other) {
+    T* table = NULL;
+    if (other.capacity > 0) {
+      table = new T[other.capacity];
+      for (int item_index = 0; item_index < other.pointer; item_index++) {
+        table[item_index] = other.items[(other.head + item_index) & (other.capacity - 1)];
       }
     }
+    this->Free();
+    this->items = table;
+    this->head = 0;
+    this->capacity = other.capacity;
+    this->pointer = other.pointer;
   }
 
   /**
-   * Refreshes the screen.
+   * Frees the item storage.
    */
-  void cIO_Control::Refresh() {
-    // To be implemented in the app.
+  template <typename T> void cDeque<T>::Free() {
+    if (this->items) {
+      delete[] this->items;
+      this->items = NULL;
+    }
   }
 
   /**
-   * Colors the screen.
-   * @param red The red component.
-   * @param green The green component.
-   * @param blue The blue component.
+   * Gets the max size of the deque before it has to grow.
+   * @return The capacity of the deque in items.
    */
-  void cIO_Control::Color(int red, int green, int blue) {
-    // To be implemented in the app.
+  template <typename T> int cDeque<T>::Get_Size() {
+    return this->capacity;
   }
 
   /**
-   * Causes the screen to update.
-   * param pp The picture processor.
+   * Clears out the deque. Storage is kept for reuse.
    */
-  void cIO_Control::Update_Display(cPicture_Processor* pp) {
-    // To be implemented in subclass.
+  template <typename T> void cDeque<T>::Clear() {
+    this->head = 0;
+    this->pointer = 0;
   }
 
   /**
-   * Loads an array of objects from a file.
-   * @param name The name of the file.
-   * @param objects The array objects to load.
-   * @throws An error if the file could not be loaded.
+   * Accesses an item from the front of the deque.
+   * @return The item on the front.
    */
-  void cIO_Control::Load(std::string name, cArray<tObject>& objects) {
-    cFile file(name);
-    file.Read();
-    while (file.Has_More_Lines()) {
-      tObject object;
-      file >>= object;
-      objects.Add(object);
-    }
+  template <typename T> T& cDeque<T>::Peek_Front() {
+    return (*this)[0];
   }
 
   /**
-   * Saves a file from a list of blocks.
-   * @param name The name of the file.
-   * @param objects The objects to save.
-   * @throws An error if the file could not be saved.
+   * Accesses an item from the back of the deque.
+   * @return The item on the back.
    */
-  void cIO_Control::Save(std::string name, cArray<tObject>& objects) {
-    cFile file(name);
-    int obj_count = objects.Count();
-    for (int obj_index = 0; obj_index < obj_count; obj_index++) {
-      tObject& object = objects[obj_index];
-      file.Add(object);
-    }
-    file.Write();
+  template <typename T> T& cDeque<T>::Peek_Back() {
+    return (*this)[this->pointer - 1];
   }
 
+  // **************************************************************************
+  // Hash Implementation
+  // **************************************************************************
+
   /**
-   * Loads a file into a matrix.
-   * @param name The name of the file.
-   * @param matrix The matrix to load.
-   * @throws An error if the file could not be loaded.
+   * Creates a new empty hash. The slot table is allocated on the first add.
    */
-  void cIO_Control::Load(std::string name, cMatrix& matrix) {
-    cFile file(name);
-    file.Read();
-    int width = 0;
-    int height = 0;
-    file >> width;
-    file >> height;
-    matrix.Resize(width, height);
-    for (int row_index = 0; row_index < height; row_index++) {
-      std::string line = file.Get_Line();
-      cArray<std::string> tokens = Parse_C_Lesh_Line(line);
-      if (tokens.Count() == width) {
-        for (int col_index = 0; col_index < width; col_index++) {
-          matrix[row_index][col_index] = Text_To_Number(tokens[col_index]);
-        }
-      }
-      else {
-        throw cError("Invalid row width.");
-      }
-    }
+  template <typename K, typename V, typename H> cHash<K, V, H>::cHash() {
+    this->slots = NULL;
+    this->slot_count = 0;
   }
 
   /**
-   * Saves a file from a matrix.
-   * @param name The name of the file.
-   * @param matrix The matrix to save.
-   * @throws An error if the file could not be saved.
+   * Copies another hash to this one.
+   * @param other The other hash.
    */
-  void cIO_Control::Save(std::string name, cMatrix& matrix) {
-    cFile file(name);
-    for (int row_index = 0; row_index < matrix.height; row_index++) {
-      std::string line = "";
-      for (int col_index = 0; col_index < matrix.width; col_index++) {
-        line += Number_To_Text(matrix[row_index][col_index]);
-        if (col_index < (matrix.width - 1)) {
-          line += " ";
-        }
-      }
-      file.Add(line);
-    }
-    file.Write();
+  template <typename K, typename V, typename H> cHash<K, V, H>::cHash(const cHash<K, V, H>& other) : keys(other.keys), values(other.values), atoms(other.atoms), hasher(other.hasher) {
+    this->slots = NULL;
+    this->slot_count = 0;
+    this->Copy_Slots(other);
   }
 
   /**
-   * Gets a new random number.
-   * @param lower The lower bound.
-   * @param upper The upper bound.
-   * @return The random number.
+   * Takes over the keys, values and slots of another hash.
+   * @param other The other hash.
    */
-  int cIO_Control::Get_Random_Number(int lower, int upper) {
-    return (lower + ((std::rand() << 8) % (upper - lower + 1)));
+  template <typename K, typename V, typename H> cHash<K, V, H>::cHash(cHash<K, V, H>&& other) : keys(std::move(other.keys)), values(std::move(other.values)), atoms(std::move(other.atoms)), hasher(other.hasher) {
+    this->slots = other.slots;
+    this->slot_count = other.slot_count;
+    other.slots = NULL;
+    other.slot_count = 0;
   }
 
   /**
-   * Gets the width of the text.
-   * @param text The text to measure.
-   * @return The width of the text.
+   * Frees the hash.
    */
-  int cIO_Control::Get_Text_Width(std::string text) {
-    // To be implemented in app.
-    return 0;
+  template <typename K, typename V, typename H> cHash<K, V, H>::~cHash() {
+    if (this->slots) {
+      delete[] this->slots;
+    }
   }
 
   /**
-   * Gets the height of the text.
-   * @param text The text to measure.
-   * @return The height of the text.
+   * Assigns another hash to this one.
+   * @param other The other hash.
+   * @return This hash.
    */
-  int cIO_Control::Get_Text_Height(std::string text) {
-    // To be implemented in app.
-    return 0;
+  template <typename K, typename V, typename H> cHash<K, V, H>& cHash<K, V, H>::operator=(const cHash<K, V, H>& other) {
+    if (this != &other) {
+      this->keys = other.keys;
+      this->values = other.values;
+      this->atoms = other.atoms;
+      this->hasher = other.hasher;
+      this->Copy_Slots(other);
+    }
+    return (*this);
   }
 
   /**
-   * Sets the canvas mode based on the flag.
+   * Swaps the keys, values and slots with another hash that is about to go away.
+   * @param other The other hash.
+   * @return This hash.
    */
-  void cIO_Control::Set_Canvas_Mode() {
-    // To be implemented in app.
+  template <typename K, typename V, typename H> cHash<K, V, H>& cHash<K, V, H>::operator=(cHash<K, V, H>&& other) {
+    this->keys = std::move(other.keys);
+    this->values = std::move(other.values);
+    this->atoms = std::move(other.atoms);
+    std::swap(this->hasher, other.hasher);
+    std::swap(this->slots, other.slots);
+    std::swap(this->slot_count, other.slot_count);
+    return (*this);
   }
 
   /**
-   * Sets the screen drawing mode.
+   * Adds a new key/value pair.
+   * @param key The key value.
+   * @param value The value.
    */
-  void cIO_Control::Set_Screen_Target() {
-    this->use_canvas = false;
+  template <typename K, typename V, typename H> void cHash<K, V, H>::Add(K key, V value) {
+    // Look for key.
+    int hash_key = this->Get_Hash_Key(key);
+    if (hash_key == NO_VALUE_FOUND) {
+      // Keep the load under three quarters so probe chains stay short.
+      if (((this->keys.Count() + 1) * 4) > (this->slot_count * 3)) {
+        this->Rehash((this->slot_count > 0) ? this->slot_count * 2 : MIN_SLOTS);
+      }
+      unsigned int hash = this->Hash(key);
+      this->keys.Add(std::move(key));
+      this->values.Add(std::move(value));
+      this->atoms.Add(NO_VALUE_FOUND);
+      this->Insert_Slot(this->keys.Count() - 1, hash);
+    }
+    else {
+      this->values[hash_key] = std::move(value);
+    }
   }
 
   /**
-   * Sets the canvas drawing mode.
+   * Removes a key/value pair from the hash. The remaining pairs keep their
+   * insertion order, so indices after the removed pair move down by one.
+   * That makes removal O(n): the pairs after it are shifted and every slot
+   * pointing past it is fixed up. Lookups and inserts stay O(1).
+   * @param key The key to match to the pair.
+   * @throws An error if the pair does not exist.
    */
-  void cIO_Control::Set_Canvas_Target() {
-    this->use_canvas = true;
+  template <typename K, typename V, typename H> void cHash<K, V, H>::Remove(const K& key) {
+    int slot_index = this->Find_Slot(key);
+    if (slot_index == NO_VALUE_FOUND) {
+      throw cError("Key was not found!");
+    }
+    else {
+      int hash_key = this->slots[slot_index].index;
+      int mask = this->slot_count - 1;
+      // Shift the following slots back until one is at its home slot.
+      int next_index = (slot_index + 1) & mask;
+      while ((this->slots[next_index].index != NO_VALUE_FOUND) && (this->Get_Probe_Distance(next_index) > 0)) {
+        this->slots[slot_index] = this->slots[next_index];
+        slot_index = next_index;
+        next_index = (next_index + 1) & mask;
+      }
+      this->slots[slot_index].index = NO_VALUE_FOUND;
+      this->keys.Remove(hash_key);
+      this->values.Remove(hash_key);
+      this->atoms.Remove(hash_key);
+      if (hash_key < this->keys.Count()) { // Not the last pair?
+        for (int entry_index = 0; entry_index < this->slot_count; entry_index++) {
+          if (this->slots[entry_index].index > hash_key) {
+            this->slots[entry_index].index--;
+          }
+        }
+      }
+    }
   }
 
   /**
-   * Gets the width of the image.
-   * @param name The name of the image.
-   * @return The width of the image in pixels.
+   * Retrieves a value given a key.
+   * @param key The key associated with the value.
+   * @return The value associated with the key.
    */
-  int cIO_Control::Get_Image_Width(std::string name) {
-    // To be implemented in app.
-    return 0;
+  template <typename K, typename V, typename H> V& cHash<K, V, H>::operator[](const K& key) {
+    int hash_key = this->Get_Hash_Key(key);
+    if (hash_key == NO_VALUE_FOUND) {
+      V value{}; // Initialize default value.
+      this->Add(key, std::move(value));
+      hash_key = this->keys.Count() - 1;
+    }
+    return this->values.At_Unchecked(hash_key);
   }
 
   /**
-   * Gets the height of the image.
-   * @param name The name of the image.
-   * @return The height of the image in pixels.
+   * Retrieves a value given an interned key.
+   * @param atom The atom of the key associated with the value.
+   * @return The value associated with the key.
    */
-  int cIO_Control::Get_Image_Height(std::string name) {
-    // To be implemented in app.
-    return 0;
+  template <typename K, typename V, typename H> V& cHash<K, V, H>::operator[](eAtom atom) {
+    int hash_key = this->Get_Hash_Key(atom);
+    if (hash_key == NO_VALUE_FOUND) {
+      V value{}; // Initialize default value.
+      this->Add(Get_Atom_Name(atom), std::move(value));
+      hash_key = this->keys.Count() - 1;
+      this->atoms.At_Unchecked(hash_key) = atom;
+    }
+    return this->values.At_Unchecked(hash_key);
   }
 
   /**
-   * Gets a list of files from a directory path.
-   * @param path The path to browse.
-   * @return A list of files in the folder.
+   * Gets the index key associated with the key of the hash.
+   * @param key The key to lookup.
+   * @return The index of the key or NO_VALUE_FOUND if the key was not found.
    */
-  cArray<std::string> cIO_Control::Get_File_List(std::string path) {
-    // To be implemented in the app.
-    cArray<std::string> files;
-    return files;
+  template <typename K, typename V, typename H> int cHash<K, V, H>::Get_Hash_Key(const K& key) {
+    int hash_key = NO_VALUE_FOUND;
+    int slot_index = this->Find_Slot(key);
+    if (slot_index != NO_VALUE_FOUND) {
+      hash_key = this->slots[slot_index].index;
+    }
+    return hash_key;
   }
 
   /**
-   * Gets the current folder where the app is running.
-   * @return The folder path.
+   * Gets the index key associated with an interned key. Small hashes remember
+   * the atom of each key once it is looked up, so later lookups only compare
+   * integers.
+   * @param atom The atom of the key to lookup.
+   * @return The index of the key or NO_VALUE_FOUND if the key was not found.
    */
-  std::string cIO_Control::Get_Current_Folder() {
-    return "";
+  template <typename K, typename V, typename H> int cHash<K, V, H>::Get_Hash_Key(eAtom atom) {
+    int count = this->atoms.Count();
+    if (count <= ATOM_SCAN_LIMIT) {
+      for (int key_index = 0; key_index < count; key_index++) {
+        if (this->atoms.At_Unchecked(key_index) == atom) {
+          return key_index;
+        }
+      }
+    }
+    int hash_key = this->Get_Hash_Key(Get_Atom_Name(atom));
+    if (hash_key != NO_VALUE_FOUND) {
+      this->atoms.At_Unchecked(hash_key) = atom;
+    }
+    return hash_key;
   }
 
   /**
-   * Gets the extension of a file based on the path.
-   * @param path The file path.
-   * @return The file extension.
+   * Clears out the hash. The slot table is kept for reuse.
    */
-  std::string cIO_Control::Get_File_Extension(std::string path) {
-    // To be implemented in the app.
-    return "";
+  template <typename K, typename V, typename H> void cHash<K, V, H>::Clear() {
+    this->keys.Clear();
+    this->values.Clear();
+    this->atoms.Clear();
+    for (int slot_index = 0; slot_index < this->slot_count; slot_index++) {
+      this->slots[slot_index].index = NO_VALUE_FOUND;
+    }
   }
 
   /**
-   * Gets the title of the file.
-   * @param path The file path.
-   * @return The file title which is the base name.
+   * Gets the number of keys/values in the hash.
+   * @return The count of items.
    */
-  std::string cIO_Control::Get_File_Title(std::string path) {
-    // To be implemented in the app.
-    return "";
+  template <typename K, typename V, typename H> int cHash<K, V, H>::Count() {
+    return this->keys.Count();
   }
 
   /**
-   * Gets the name of the file.
-   * @param path The file path.
-   * @return The name of the file.
+   * Checks to see if a key exists.
+   * @param key The key.
+   * @return True if the key exists, false otherwise.
    */
-  std::string cIO_Control::Get_File_Name(std::string path) {
-    // To be implemented in the app.
-    return "";
+  template <typename K, typename V, typename H> bool cHash<K, V, H>::Does_Key_Exist(const K& key) {
+    int hash_key = this->Get_Hash_Key(key);
+    return (hash_key != NO_VALUE_FOUND);
   }
 
-  // **************************************************************************
-  // List Implementation
-  // **************************************************************************
+  /**
+   * Checks to see if an interned key exists.
+   * @param atom The atom of the key.
+   * @return True if the key exists, false otherwise.
+   */
+  template <typename K, typename V, typename H> bool cHash<K, V, H>::Does_Key_Exist(eAtom atom) {
+    int hash_key = this->Get_Hash_Key(atom);
+    return (hash_key != NO_VALUE_FOUND);
+  }
 
   /**
-   * Creates a list with one item.
+   * Computes the hash of a key. The hash function's output is mixed so
+   * that keys with regular hashes, like integers, still spread out.
+   * @param key The key.
+   * @return The hash value.
    */
-  cList::cList() {
-    this->items.Add(0);
+  template <typename K, typename V, typename H> unsigned int cHash<K, V, H>::Hash(const K& key) {
+    unsigned long long hash = (unsigned long long)this->hasher(key);
+    hash *= 0x9E3779B97F4A7C15ULL;
+    return (unsigned int)(hash >> 32);
   }
 
   /**
-   * Creates a new list of the specified size.
-   * @param size The size of the list.
+   * Finds the slot holding a key.
+   * @param key The key to look for.
+   * @return The slot index or NO_VALUE_FOUND if the key is not in the hash.
    */
-  cList::cList(int size) {
-    for (int item_index = 0; item_index < size; item_index++) {
-      this->items.Add(0);
+  template <typename K, typename V, typename H> int cHash<K, V, H>::Find_Slot(const K& key) {
+    int slot_index = NO_VALUE_FOUND;
+    if (this->slot_count > 0) {
+      unsigned int hash = this->Hash(key);
+      int mask = this->slot_count - 1;
+      int entry_index = hash & mask;
+      for (int distance = 0; distance < this->slot_count; distance++) {
+        sHash_Slot& slot = this->slots[entry_index];
+        // A richer slot than us means our key would have been placed before it.
+        if ((slot.index == NO_VALUE_FOUND) || (this->Get_Probe_Distance(entry_index) < distance)) {
+          break;
+        }
+        if ((slot.hash == hash) && (this->keys.At_Unchecked(slot.index) == key)) {
+          slot_index = entry_index;
+          break;
+        }
+        entry_index = (entry_index + 1) & mask;
+      }
     }
+    return slot_index;
   }
 
   /**
-   * Accesses the item at the index.
-   * @param index The index of the item.
-   * @return The reference to the item.
-   * @throws An error if the index is out of bounds.
+   * Places a key index into the slot table using Robin Hood probing. A slot
+   * closer to its home than the entry being placed gives up its spot.
+   * @param index The index of the key.
+   * @param hash The hash of the key.
    */
-  int& cList::operator[](int index) {
-    if ((index < 0) || (index >= this->items.Count())) {
-      throw cError("List index is out of bounds.");
+  template <typename K, typename V, typename H> void cHash<K, V, H>::Insert_Slot(int index, unsigned int hash) {
+    sHash_Slot entry = { index, hash };
+    int mask = this->slot_count - 1;
+    int entry_index = hash & mask;
+    int distance = 0;
+    while (this->slots[entry_index].index != NO_VALUE_FOUND) {
+      int slot_distance = this->Get_Probe_Distance(entry_index);
+      if (slot_distance < distance) {
+        std::swap(entry, this->slots[entry_index]);
+        distance = slot_distance;
+      }
+      entry_index = (entry_index + 1) & mask;
+      distance++;
     }
-    return this->items[index];
+    this->slots[entry_index] = entry;
   }
 
   /**
-   * Assigns a list to another.
-   * @param other The other list.
-   * @return This list.
+   * Gets how far a slot is from the home slot of its key.
+   * @param slot_index The slot index.
+   * @return The probe distance.
    */
-  cList& cList::operator=(const cList& other) {
-    this->items = other.items;
-    return (*this);
+  template <typename K, typename V, typename H> int cHash<K, V, H>::Get_Probe_Distance(int slot_index) {
+    int mask = this->slot_count - 1;
+    return ((slot_index - (int)(this->slots[slot_index].hash & mask)) & mask);
   }
 
   /**
-   * Clears out the list.
+   * Reallocates the slot table and places all keys again.
+   * @param count The new number of slots. Must be a power of two.
    */
-  void cList::Clear() {
-    int item_count = this->items.Count();
-    for (int item_index = 0; item_index < item_count; item_index++) {
-      this->items[item_index] = 0;
+  template <typename K, typename V, typename H> void cHash<K, V, H>::Rehash(int count) {
+    sHash_Slot* old_slots = this->slots;
+    int old_count = this->slot_count;
+    this->slots = new sHash_Slot[count];
+    this->slot_count = count;
+    for (int slot_index = 0; slot_index < count; slot_index++) {
+      this->slots[slot_index].index = NO_VALUE_FOUND;
+    }
+    for (int slot_index = 0; slot_index < old_count; slot_index++) {
+      sHash_Slot& slot = old_slots[slot_index];
+      if (slot.index != NO_VALUE_FOUND) {
+        this->Insert_Slot(slot.index, slot.hash);
+      }
+    }
+    if (old_slots) {
+      delete[] old_slots;
     }
   }
 
   /**
-   * Adds a value to the list.
-   * @param value The value to add.
+   * Copies the slot table of another hash.
+   * @param other The other hash.
    */
-  void cList::Add(int value) {
-    this->items.Add(value);
+  template <typename K, typename V, typename H> void cHash<K, V, H>::Copy_Slots(const cHash<K, V, H>& other) {
+    sHash_Slot* table = NULL;
+    if (other.slot_count > 0) {
+      table = new sHash_Slot[other.slot_count];
+      for (int slot_index = 0; slot_index < other.slot_count; slot_index++) {
+        table[slot_index] = other.slots[slot_index];
+      }
+    }
+    if (this->slots) {
+      delete[] this->slots;
+    }
+    this->slots = table;
+    this->slot_count = other.slot_count;
   }
 
+  // **************************************************************************
+  // Atom Table Implementation
+  // **************************************************************************
+
   /**
-   * Removes an item from the list.
-   * @param index The index of the item.
-   * @throws An error if the index is invalid.
-   */
-  void cList::Remove(int index) {
-    if ((index < 0) || (index >= this->items.Count())) {
-      throw cError("Invalid index.");
+   * Creates the atom table with the built-in atoms in eAtom order.
+   */
+  cAtom_Table::cAtom_Table() {
+    const char* built_ins[eATOM_COUNT] = {
+      "id",
+      "type",
+      "x",
+      "y",
+      "width",
+      "height",
+      "text",
+      "label",
+      "red",
+      "green",
+      "blue",
+      "rows",
+      "columns",
+      "items",
+      "scroll-x",
+      "scroll-y",
+      "grid-x",
+      "grid-y",
+      "sel-item",
+      "item-x",
+      "item-y"
+    };
+    for (int atom_index = 0; atom_index < eATOM_COUNT; atom_index++) {
+      this->Intern(built_ins[atom_index]);
+    }
+  }
+
+  /**
+   * Interns a name, giving it a small integer atom. Interning the same name
+   * again gives back the same atom.
+   * @param name The name to intern.
+   * @return The atom of the name.
+   */
+  eAtom cAtom_Table::Intern(const std::string& name) {
+    int atom = this->atoms.Get_Hash_Key(name);
+    if (atom == NO_VALUE_FOUND) {
+      atom = this->names.Count();
+      this->names.Add(name);
+      this->atoms.Add(name, atom);
     }
-    this->items.Remove(index);
+    else {
+      atom = this->atoms.values.At_Unchecked(atom);
+    }
+    return (eAtom)atom;
   }
 
   /**
-   * Gets the count of the items.
-   * @return The number of items.
+   * Gets the name that was interned for an atom.
+   * @param atom The atom.
+   * @return The name of the atom.
+   * @throws An error if the atom was never interned.
    */
-  int cList::Count() {
-    return this->items.Count();
+  std::string& cAtom_Table::Get_Name(eAtom atom) {
+    Check_Condition(((atom >= 0) && (atom < this->names.Count())), "Atom was never interned.");
+    return this->names.At_Unchecked(atom);
   }
 
   // **************************************************************************
-  // Matrix Implementation
+  // Tokenizer Implementation
   // **************************************************************************
 
   /**
-   * Creates a 1x1 matrix.
+   * Creates a tokenizer that splits text on a delimiter. Tokens are views into
+   * the text so the text has to outlive the tokenizer.
+   * @param text The text to split.
+   * @param delimiter The delimiting letter.
    */
-  cMatrix::cMatrix() {
-    this->Resize(1, 1);
+  cTokenizer::cTokenizer(std::string_view text, char delimiter) {
+    this->text = text;
+    this->position = 0;
+    this->delimiter = delimiter;
+    this->whitespace = false;
   }
 
   /**
-   * Creates a new matrix with a specified size.
-   * @param width The width of the matrix.
-   * @param height The height of the matrix.
+   * Creates a tokenizer that splits text on spaces and tabs.
+   * @param text The text to split.
    */
-  cMatrix::cMatrix(int width, int height) {
-    this->Resize(width, height);
+  cTokenizer::cTokenizer(std::string_view text) {
+    this->text = text;
+    this->position = 0;
+    this->delimiter = ' ';
+    this->whitespace = true;
   }
 
   /**
-   * Gets the list at the index.
-   * @param index The index of the list.
-   * @return The list reference.
-   * @throws An error if the index is out of bounds.
+   * Gets the next token. Empty tokens are skipped.
+   * @param token The token that was found.
+   * @return True if there was a token, false if the text is used up.
    */
-  cList& cMatrix::operator[](int index) {
-    if ((index < 0) || (index >= this->height)) {
-      throw cError("Index is out of bounds for matrix.");
+  bool cTokenizer::Next(std::string_view& token) {
+    int length = this->text.length();
+    const char* data = this->text.data();
+    if (this->whitespace) {
+      while ((this->position < length) && ((data[this->position] == ' ') || (data[this->position] == '\t'))) {
+        this->position++;
+      }
+      if (this->position == length) {
+        return false;
+      }
+      int start = this->position;
+      while ((this->position < length) && (data[this->position] != ' ') && (data[this->position] != '\t')) {
+        this->position++;
+      }
+      token = std::string_view(data + start, this->position - start);
+      return true;
+    }
+    while (this->position < length) {
+      const char* start = data + this->position;
+      const char* end = (const char*)std::memchr(start, this->delimiter, length - this->position);
+      int count = (end != NULL) ? (end - start) : (length - this->position);
+      this->position += (end != NULL) ? (count + 1) : count; // Pass over the delimiter.
+      if (count > 0) { // No NULL tokens!
+        token = std::string_view(start, count);
+        return true;
+      }
     }
-    return this->rows[index];
+    return false;
   }
 
   /**
-   * Clears out the matrix.
+   * Determines if there are more tokens without moving past them.
+   * @return True if there are more tokens, false otherwise.
    */
-  void cMatrix::Clear() {
-    int row_count = this->rows.Count();
-    for (int row_index = 0; row_index < row_count; row_index++) {
-      this->rows[row_index].Clear();
+  bool cTokenizer::Has_More_Tokens() {
+    int position = this->position;
+    std::string_view token;
+    bool has_more = this->Next(token);
+    this->position = position;
+    return has_more;
+  }
+
+  /**
+   * Counts all of the tokens in the text.
+   * @return The number of tokens.
+   */
+  int cTokenizer::Count() {
+    int position = this->position;
+    this->position = 0;
+    int token_count = 0;
+    std::string_view token;
+    while (this->Next(token)) {
+      token_count++;
     }
+    this->position = position;
+    return token_count;
   }
 
   /**
-   * Resizes the matrix.
-   * @param width The new width.
-   * @param height The new height.
+   * Reads the rest of the tokens into a fixed array.
+   * @param tokens The array to store the tokens in.
+   * @param max_count The number of tokens the array can hold.
+   * @return The number of tokens that were left, which can be more than max_count.
    */
-  void cMatrix::Resize(int width, int height) {
-    this->width = width;
-    this->height = height;
-    this->rows.Clear();
-    for (int row_index = 0; row_index < height; row_index++) {
-      cList list(width);
-      this->rows.Add(list);
+  int cTokenizer::Split(std::string_view* tokens, int max_count) {
+    int token_count = 0;
+    std::string_view token;
+    while (this->Next(token)) {
+      if (token_count < max_count) {
+        tokens[token_count] = token;
+      }
+      token_count++;
+    }
+    return token_count;
+  }
+
+  /**
+   * Gets a token by its index from the start of the text.
+   * @param index The index of the token.
+   * @return The token.
+   * @throws An error if there is no token at the index.
+   */
+  std::string_view cTokenizer::Get_Token(int index) {
+    int position = this->position;
+    this->position = 0;
+    std::string_view token;
+    int token_index = 0;
+    bool found = false;
+    while ((index >= 0) && this->Next(token)) {
+      if (token_index == index) {
+        found = true;
+        break;
+      }
+      token_index++;
+    }
+    this->position = position;
+    if (!found) {
+      throw cError("No token at index " + Number_To_Text(index) + ".");
     }
+    return token;
+  }
+
+  /**
+   * Moves the tokenizer back to the start of the text.
+   */
+  void cTokenizer::Rewind() {
+    this->position = 0;
   }
 
   // **************************************************************************
-  // Terminal Implementation
+  // Error Implementation
   // **************************************************************************
 
   /**
-   * Creates a new terminal.
-   * @param width The width of the terminal, in characters.
-   * @param height The height of the terminal, in characters.
-   * @param letter_w The width of a single letter.
-   * @param letter_h The height of a single letter.
-   * @param io The I/O control.
+   * Initializes an error with a message.
+   * @param message The message to give the error.
    */
-  cTerminal::cTerminal(int width, int height, int letter_w, int letter_h, cIO_Control* io) {
-    this->width = width;
-    this->height = height;
-    this->letter_w = letter_w;
-    this->letter_h = letter_h;
-    this->red = 0;
-    this->green = 0;
-    this->blue = 0;
-    this->io = io;
-    this->status = eSTATUS_OUTPUT;
-    this->counter = 0;
-    // Add first line.
-    tLine first_line;
-    this->lines.Add(first_line);
-    // Add time stamp.
-    this->time_stamp = std::chrono::system_clock::now();
-    this->scroll_x = 0;
-    this->scroll_y = 0;
+  cError::cError(std::string message) {
+    this->message = message;
   }
 
   /**
-   * Writes a letter to the line buffer.
-   * @param letter The letter to write.
+   * Prints an error to the console.
    */
-  void cTerminal::Write_Letter(int letter) {
-    if (letter == '\n') {
-      tLine new_line;
-      this->lines.Add(new_line); // Push in new line.
-      if (this->lines.Count() > this->height) {
-        this->scroll_y++;
-      }
-    }
-    else {
-      tLine& last_line = this->lines.Peek_Back(); // Get last line.
-      sLetter l;
-      l.letter = letter;
-      l.red = this->red;
-      l.green = this->green;
-      l.blue = this->blue;
-      last_line.Add(l);
-    }
+  void cError::Print() {
+    std::cout << "Error: " << this->message << std::endl;
   }
 
+  // **************************************************************************
+  // File Implementation
+  // **************************************************************************
+
   /**
-   * Writes a string to the terminal.
-   * @param text The text to output to the terminal.
+   * Creates a new file object.
+   * @param name The name of the file.
    */
-  void cTerminal::Write_String(std::string text) {
-    int letter_count = text.length();
-    for (int letter_index = 0; letter_index < letter_count; letter_index++) {
-      this->Write_Letter(text[letter_index]);
-    }
+  cFile::cFile(std::string name) {
+    this->name = name;
+    this->pointer = 0;
   }
 
   /**
-   * Sets the color of the terminal text.
-   * @param red The red component.
-   * @param green The green component.
-   * @param blue The blue component.
+   * Copies another file object.
+   * @param other The other file.
    */
-  void cTerminal::Set_Color(int red, int green, int blue) {
-    this->red = red;
-    this->green = green;
-    this->blue = blue;
+  cFile::cFile(const cFile& other) : data(other.data), spans(other.spans), name(other.name), pointer(other.pointer) {
+    // Nothing here.
   }
 
   /**
-   * This clears out the terminal.
+   * Takes over the lines of another file object.
+   * @param other The other file.
    */
-  void cTerminal::Clear() {
-    this->lines.Clear();
+  cFile::cFile(cFile&& other) : data(std::move(other.data)), spans(std::move(other.spans)), name(std::move(other.name)), pointer(other.pointer) {
+    other.pointer = 0;
   }
 
   /**
-   * Reads input from the user. Stops when enter is hit.
+   * Assigns another file object to this one.
+   * @param other The other file.
+   * @return This file.
    */
-  void cTerminal::Read_Input() {
-    if (this->status != eSTATUS_INPUT) {
-      this->status = eSTATUS_INPUT;
-      this->Set_Color(0, 128, 0);
-      this->Write_String(": ");
-    }
+  cFile& cFile::operator=(const cFile& other) {
+    this->data = other.data;
+    this->spans = other.spans;
+    this->name = other.name;
+    this->pointer = other.pointer;
+    return (*this);
   }
 
   /**
-   * Processes keys.
+   * Moves another file object into this one.
+   * @param other The other file.
+   * @return This file.
    */
-  void cTerminal::Process_Keys() {
-    sSignal key = this->io->Read_Key();
-    switch (key.code) {
-      case eSIGNAL_ENTER: {
-        if (this->status == eSTATUS_INPUT) {
-          this->Write_Letter('\n');
-          this->Set_Error_Mode(false);
-          this->On_Read(this->Buffer_To_String());
-        }
-        break;
-      }
-      case eSIGNAL_BACKSPACE: {
-        this->Backspace();
-        break;
-      }
-      case eSIGNAL_LEFT: {
-        if (this->scroll_x > 0) {
-          this->scroll_x--;
-        }
-        break;
-      }
-      case eSIGNAL_RIGHT: {
-        this->scroll_x++;
-        break;
-      }
-      case eSIGNAL_UP: {
-        if (this->scroll_y > 0) {
-          this->scroll_y--;
-        }
-        break;
-      }
-      case eSIGNAL_DOWN: {
-        this->scroll_y++;
-        break;
-      }
-      default: { // Any character.
-        if ((key.code >= ' ') && (key.code <= '~')) { // Data characters.
-          if (this->status == eSTATUS_INPUT) {
-            this->Write_Letter(key.code);
-            this->input_buffer.Add(key.code);
-          }
-        }
-      }
-    }
+  cFile& cFile::operator=(cFile&& other) {
+    this->data = std::move(other.data);
+    this->spans = std::move(other.spans);
+    this->name = std::move(other.name);
+    std::swap(this->pointer, other.pointer);
+    return (*this);
   }
 
   /**
-   * Renders the terminal screen.
+   * Reads a file from disk. The whole file is read in one go and the lines are
+   * kept as spans of the file data. Lines can end with \r, \n or \r\n.
+   * @throws An error if something went wrong.
    */
-  void cTerminal::Render() {
-    // Clear the screen.
-    this->io->Color(255, 255, 255);
-    // Render current screenfull of lines.
-    int line_count = this->lines.Count();
-    for (int row_index = 0; row_index < line_count; row_index++) {
-      tLine& line = this->lines[row_index];
-      int letter_count = line.Count();
-      for (int letter_index = 0; letter_index < letter_count; letter_index++) {
-        sLetter& letter = line[letter_index];
-        char buffer[2] = { (char)letter.letter, 0 };
-        this->io->Output_Text(buffer, (letter_index - this->scroll_x) * this->letter_w, (row_index - this->scroll_y) * this->letter_h, letter.red, letter.green, letter.blue);
+  void cFile::Read() {
+    this->Clear(); // Clear out lines.
+    Read_File_Data(this->name, this->data);
+    int size = this->data.length();
+    const char* letters = this->data.data();
+    bool has_returns = (std::memchr(letters, '\r', size) != NULL);
+    int position = 0;
+    while (position < size) {
+      const char* new_line = (const char*)std::memchr(letters + position, '\n', size - position);
+      int end = (new_line != NULL) ? (new_line - letters) : size;
+      int start = position;
+      if (has_returns) { // Windows/Mac
+        const char* carriage = (const char*)std::memchr(letters + start, '\r', end - start);
+        while (carriage != NULL) {
+          int carriage_pos = carriage - letters;
+          this->spans.Add({ start, carriage_pos - start });
+          start = carriage_pos + 1;
+          carriage = (const char*)std::memchr(letters + start, '\r', end - start);
+        }
       }
-    }
-    // Draw the cursor.
-    if (this->status == eSTATUS_INPUT) {
-      auto now = std::chrono::system_clock::now();
-      auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(now - this->time_stamp);
-      if (diff.count() >= BLINK_RATE) {
-        this->time_stamp = std::chrono::system_clock::now();
-        this->counter++;
+      if (new_line != NULL) { // Unix/Linux
+        bool after_return = ((start == end) && (end > position) && (letters[end - 1] == '\r'));
+        if (!after_return) {
+          this->spans.Add({ start, end - start });
+        }
+        position = end + 1;
       }
-      if ((this->counter % 2) == 0) {
-        int x = (this->lines.Peek_Back().Count() > 0) ? this->lines.Peek_Back().Count() - 1 : 0;
-        int y = this->lines.Count() - 1;
-        this->io->Box((x + 1 - this->scroll_x) * this->letter_w, (y - this->scroll_y) * this->letter_h, this->letter_w, this->letter_h, 0, 0, 0);
+      else {
+        // Add the last line.
+        if (end > start) {
+          this->spans.Add({ start, end - start });
+        }
+        position = size;
       }
     }
-    // Refresh the screen.
-    this->io->Refresh();
   }
 
   /**
-   * Backspaces a character out.
+   * Writes the file to disk.
+   * @throws An error if the file could not be saved.
    */
-  void cTerminal::Backspace() {
-    if (this->status == eSTATUS_INPUT) {
-      if (this->input_buffer.Count() > 0) {
-        tLine& line = this->lines.Peek_Back();
-        if (line.Count() > 0) {
-          line.Pop(); // Remove character.
-          this->input_buffer.Pop(); // Remove from input buffer as well.
-        }
-      }
+  void cFile::Write() {
+    cFile_Writer file(this->name);
+    const char* letters = this->data.data();
+    for (sLine_Span& span : this->spans) {
+      file.Write_Line(std::string_view(letters + span.start, span.length));
+    }
+    file.Close();
+  }
+
+  /**
+   * Adds a line to the file.
+   * @param line The line to add.
+   */
+  void cFile::Add(std::string line) {
+    this->spans.Add({ (int)this->data.length(), (int)line.length() });
+    this->data += line;
+  }
+
+  /**
+   * Adds a number to the file.
+   * @param number The number to add.
+   */
+  void cFile::Add(int number) {
+    int start = this->data.length();
+    Append_Number(this->data, number);
+    this->spans.Add({ start, (int)this->data.length() - start });
+  }
+
+  /**
+   * Adds an object to the file.
+   * @param object The object to add to the file.
+   */
+  void cFile::Add(tObject& object) {
+    int field_count = object.Count();
+    this->Add("object");
+    for (int field_index = 0; field_index < field_count; field_index++) {
+      cValue& value = object.values[field_index];
+      std::string line = object.keys[field_index];
+      line += '=';
+      if (value.type == eVALUE_NUMBER) {
+        Append_Number(line, value.number);
+        this->Add(std::move(line));
+      }
+      else if (value.type == eVALUE_STRING) {
+        line += value.string;
+        this->Add(std::move(line));
+      }
+    }
+    this->Add("end");
+  }
+
+  /**
+   * Removes a line at a specified index.
+   * @param index The index of the line to remove.
+   * @throws An error if the index is not valid.
+   */
+  void cFile::Remove(int index) {
+    this->spans.Remove(index);
+  }
+
+  /**
+   * Gets the number of lines in the file.
+   * @return The number of lines in the file.
+   */
+  int cFile::Count() {
+    return this->spans.Count();
+  }
+
+  /**
+   * Gets the string at the index.
+   * @param index The index of the string.
+   * @return The string at the index.
+   * @throws An error if the string is not present.
+   */
+  std::string cFile::operator[](int index) {
+    return std::string(this->View_Line(index));
+  }
+
+  /**
+   * Gets a view of the line at the index. The view is good until the file is
+   * changed.
+   * @param index The index of the line.
+   * @return The line.
+   * @throws An error if the line is not present.
+   */
+  std::string_view cFile::View_Line(int index) {
+    sLine_Span& span = this->spans[index];
+    return std::string_view(this->data.data() + span.start, span.length);
+  }
+
+  /**
+   * Gets a line from the file sequentially.
+   * @return The read line.
+   * @throws An error if no more lines can be read.
+   */
+  std::string cFile::Get_Line() {
+    Check_Condition(this->Has_More_Lines(), "No more lines to read.");
+    return std::string(this->View_Line(this->pointer++));
+  }
+
+  /**
+   * Reads a numeric value from an index.
+   * @param number The number to read.
+   * @throws An error if the number could not be read.
+   */
+  void cFile::operator>>(int& number) {
+    Check_Condition(this->Has_More_Lines(), "No more lines to read.");
+    number = Text_To_Number(this->View_Line(this->pointer++));
+  }
+
+  /**
+   * Reads an object from the file.
+   * @param object The object to read in.
+   * @throws An error if the object could not be read.
+   */
+  void cFile::operator>>=(tObject& object) {
+    Check_Condition(this->Has_More_Lines(), "No more lines to read.");
+    std::string_view line = this->View_Line(this->pointer++);
+    if (line != "object") {
+      throw cError("Object identifier missing.");
+    }
+    while (line != "end") {
+      Check_Condition(this->Has_More_Lines(), "No more lines to read.");
+      line = this->View_Line(this->pointer++);
+      Parse_Object_Field(line, object);
+    }
+  }
+
+  /**
+   * Clears out the file's lines.
+   */
+  void cFile::Clear() {
+    this->data.clear();
+    this->spans.Clear();
+    this->pointer = 0;
+  }
+
+  /**
+   * Determines if a file has more lines.
+   * @return True if there are more lines, false otherwise.
+   */
+  bool cFile::Has_More_Lines() {
+    return (this->pointer < this->spans.Count());
+  }
+
+  // **************************************************************************
+  // File Reader Implementation
+  // **************************************************************************
+
+  /**
+   * Opens a file for reading line by line. Only a small buffer of the file is
+   * held in memory at any time.
+   * @param name The name of the file.
+   * @throws An error if the file could not be opened.
+   */
+  cFile_Reader::cFile_Reader(std::string name) {
+    this->name = name;
+    this->file.open(name, std::ios::binary);
+    if (!this->file) {
+      throw cError("Could not read file " + name + ".");
+    }
+    this->buffer = new char[BUFFER_SIZE];
+    this->capacity = BUFFER_SIZE;
+    this->start = 0;
+    this->end = 0;
+    this->line_start = 0;
+    this->line_length = 0;
+    this->has_line = false;
+    this->skip_new_line = false;
+    this->at_end = false;
+  }
+
+  /**
+   * Closes the file and frees the buffer.
+   */
+  cFile_Reader::~cFile_Reader() {
+    delete[] this->buffer;
+  }
+
+  /**
+   * Reads the next line.
+   * @return The line.
+   * @throws An error if no more lines can be read.
+   */
+  std::string cFile_Reader::Get_Line() {
+    return std::string(this->View_Line());
+  }
+
+  /**
+   * Reads the next line without copying it. The view is only good until the
+   * next line is read.
+   * @return The line.
+   * @throws An error if no more lines can be read.
+   */
+  std::string_view cFile_Reader::View_Line() {
+    Check_Condition(this->Has_More_Lines(), "No more lines to read.");
+    this->has_line = false;
+    return std::string_view(this->buffer + this->line_start, this->line_length);
+  }
+
+  /**
+   * Reads a number from the next line.
+   * @param number The number to read.
+   * @throws An error if the number could not be read.
+   */
+  void cFile_Reader::operator>>(int& number) {
+    number = Text_To_Number(this->View_Line());
+  }
+
+  /**
+   * Reads an object from the file.
+   * @param object The object to read in.
+   * @throws An error if the object could not be read.
+   */
+  void cFile_Reader::operator>>=(tObject& object) {
+    std::string_view line = this->View_Line();
+    if (line != "object") {
+      throw cError("Object identifier missing.");
+    }
+    while (line != "end") {
+      line = this->View_Line();
+      Parse_Object_Field(line, object);
+    }
+  }
+
+  /**
+   * Determines if there are more lines to read.
+   * @return True if there are more lines, false otherwise.
+   * @throws An error if the file could not be read.
+   */
+  bool cFile_Reader::Has_More_Lines() {
+    return this->Find_Line();
+  }
+
+  /**
+   * Finds the next line in the buffer, reading more of the file as needed.
+   * Lines end the same way as in cFile::Read.
+   * @return True if a line was found, false if the file is used up.
+   * @throws An error if the file could not be read.
+   */
+  bool cFile_Reader::Find_Line() {
+    while (!this->has_line) {
+      if (this->skip_new_line && (this->start < this->end)) { // Second half of \r\n.
+        if (this->buffer[this->start] == '\n') {
+          this->start++;
+        }
+        this->skip_new_line = false;
+      }
+      if (this->start < this->end) {
+        const char* letters = this->buffer + this->start;
+        int count = this->end - this->start;
+        const char* new_line = (const char*)std::memchr(letters, '\n', count);
+        int limit = (new_line != NULL) ? (new_line - letters) : count;
+        const char* carriage = (const char*)std::memchr(letters, '\r', limit);
+        const char* line_end = (carriage != NULL) ? carriage : new_line;
+        if (line_end != NULL) {
+          this->line_start = this->start;
+          this->line_length = line_end - letters;
+          this->start += this->line_length + 1;
+          this->skip_new_line = (line_end == carriage);
+          this->has_line = true;
+          break;
+        }
+      }
+      if (this->at_end) {
+        if (this->start < this->end) { // Add the last line.
+          this->line_start = this->start;
+          this->line_length = this->end - this->start;
+          this->start = this->end;
+          this->has_line = true;
+        }
+        break;
+      }
+      this->Fill_Buffer();
+    }
+    return this->has_line;
+  }
+
+  /**
+   * Moves the unread part of the buffer to the front and reads more of the
+   * file after it. The buffer only grows if a single line does not fit.
+   * @throws An error if the file could not be read.
+   */
+  void cFile_Reader::Fill_Buffer() {
+    int remaining = this->end - this->start;
+    if (this->start > 0) {
+      std::memmove(this->buffer, this->buffer + this->start, remaining);
+      this->start = 0;
+      this->end = remaining;
+    }
+    if (this->end == this->capacity) { // Line is longer than the buffer.
+      char* buffer = new char[this->capacity * 2];
+      std::memcpy(buffer, this->buffer, this->end);
+      delete[] this->buffer;
+      this->buffer = buffer;
+      this->capacity *= 2;
+    }
+    this->file.read(this->buffer + this->end, this->capacity - this->end);
+    int read_count = this->file.gcount();
+    if (this->file.bad()) {
+      throw cError("Problem reading file " + this->name + ".");
+    }
+    this->end += read_count;
+    if (read_count == 0) {
+      this->at_end = true;
+    }
+  }
+
+  // **************************************************************************
+  // Byte Reader Implementation
+  // **************************************************************************
+
+  /**
+   * Creates a reader over a block of binary data.
+   * @param data The data to read.
+   * @param size The size of the data in bytes.
+   */
+  cByte_Reader::cByte_Reader(const char* data, int size) {
+    this->data = data;
+    this->size = size;
+    this->pointer = 0;
+  }
+
+  /**
+   * Reads a single byte.
+   * @return The byte.
+   * @throws An error if the data is used up.
+   */
+  unsigned char cByte_Reader::Read_Byte() {
+    Check_Condition((this->pointer < this->size), "Unexpected end of binary data.");
+    return (unsigned char)this->data[this->pointer++];
+  }
+
+  /**
+   * Reads a 32-bit number stored in little endian byte order.
+   * @return The number.
+   * @throws An error if the data is used up.
+   */
+  int cByte_Reader::Read_Int32() {
+    Check_Condition(((this->size - this->pointer) >= 4), "Unexpected end of binary data.");
+    const unsigned char* bytes = (const unsigned char*)(this->data + this->pointer);
+    this->pointer += 4;
+    return (int)(bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((unsigned int)bytes[3] << 24));
+  }
+
+  /**
+   * Reads a number of bytes without copying them.
+   * @param count The number of bytes.
+   * @return A view of the bytes.
+   * @throws An error if there are not enough bytes.
+   */
+  std::string_view cByte_Reader::Read_Bytes(int count) {
+    Check_Condition(((count >= 0) && ((this->size - this->pointer) >= count)), "Unexpected end of binary data.");
+    std::string_view bytes(this->data + this->pointer, count);
+    this->pointer += count;
+    return bytes;
+  }
+
+  /**
+   * Reads bytes prefixed with their 32-bit length.
+   * @return A view of the bytes.
+   * @throws An error if there are not enough bytes.
+   */
+  std::string_view cByte_Reader::Read_Text() {
+    int count = this->Read_Int32();
+    return this->Read_Bytes(count);
+  }
+
+  /**
+   * Determines if there are more bytes to read.
+   * @return True if there are more bytes, false otherwise.
+   */
+  bool cByte_Reader::Has_More_Bytes() {
+    return (this->pointer < this->size);
+  }
+
+  // **************************************************************************
+  // File Writer Implementation
+  // **************************************************************************
+
+  /**
+   * Opens a file for buffered writing.
+   * @param name The name of the file.
+   * @throws An error if the file could not be opened.
+   */
+  cFile_Writer::cFile_Writer(std::string name) {
+    this->Open(name, false);
+  }
+
+  /**
+   * Opens a file for buffered writing. An atomic writer writes to a temporary
+   * file that only replaces the real file when it is closed.
+   * @param name The name of the file.
+   * @param atomic True if the file is written atomically.
+   * @throws An error if the file could not be opened.
+   */
+  cFile_Writer::cFile_Writer(std::string name, bool atomic) {
+    this->Open(name, atomic);
+  }
+
+  /**
+   * Finishes the file if it was not closed. An atomic file that was not closed
+   * is thrown away so the real file is left as it was.
+   */
+  cFile_Writer::~cFile_Writer() {
+    if (!this->closed) {
+      if (this->atomic) {
+        this->file.close();
+        std::remove(this->temp_name.c_str());
+      }
+      else {
+        try {
+          this->Flush();
+        }
+        catch (cError write_error) {
+          // Nothing can be reported here.
+        }
+      }
+    }
+    delete[] this->buffer;
+  }
+
+  /**
+   * Opens the file and sets up the buffer.
+   * @param name The name of the file.
+   * @param atomic True if the file is written atomically.
+   * @throws An error if the file could not be opened.
+   */
+  void cFile_Writer::Open(std::string name, bool atomic) {
+    this->name = name;
+    this->temp_name = atomic ? (name + ".tmp") : name;
+    this->atomic = atomic;
+    this->closed = false;
+    this->pointer = 0;
+    this->buffer = NULL;
+    this->file.open(this->temp_name, std::ios::binary);
+    if (!this->file) {
+      throw cError("Could not write file " + name + ".");
+    }
+    this->buffer = new char[BUFFER_SIZE];
+  }
+
+  /**
+   * Writes text to the file.
+   * @param text The text to write.
+   * @throws An error if the file could not be written.
+   */
+  void cFile_Writer::Write_Text(std::string_view text) {
+    int length = text.length();
+    if (length > (BUFFER_SIZE - this->pointer)) {
+      this->Flush();
+    }
+    if (length >= BUFFER_SIZE) { // Too big to buffer.
+      this->file.write(text.data(), length);
+      Check_Condition(this->file.good(), "Could not write file " + this->name + ".");
+    }
+    else {
+      std::memcpy(this->buffer + this->pointer, text.data(), length);
+      this->pointer += length;
+    }
+  }
+
+  /**
+   * Writes a single letter to the file.
+   * @param letter The letter to write.
+   * @throws An error if the file could not be written.
+   */
+  void cFile_Writer::Write_Letter(char letter) {
+    if (this->pointer == BUFFER_SIZE) {
+      this->Flush();
+    }
+    this->buffer[this->pointer++] = letter;
+  }
+
+  /**
+   * Writes a number as text to the file.
+   * @param number The number to write.
+   * @throws An error if the file could not be written.
+   */
+  void cFile_Writer::Write_Number(int number) {
+    if ((BUFFER_SIZE - this->pointer) < NUMBER_TEXT_SIZE) {
+      this->Flush();
+    }
+    this->pointer += Format_Number(number, this->buffer + this->pointer);
+  }
+
+  /**
+   * Writes a 32-bit number in little endian byte order.
+   * @param number The number to write.
+   * @throws An error if the file could not be written.
+   */
+  void cFile_Writer::Write_Int32(int number) {
+    if ((BUFFER_SIZE - this->pointer) < 4) {
+      this->Flush();
+    }
+    unsigned int bits = number;
+    this->buffer[this->pointer++] = (char)(bits & 0xFF);
+    this->buffer[this->pointer++] = (char)((bits >> 8) & 0xFF);
+    this->buffer[this->pointer++] = (char)((bits >> 16) & 0xFF);
+    this->buffer[this->pointer++] = (char)((bits >> 24) & 0xFF);
+  }
+
+  /**
+   * Writes bytes prefixed with their 32-bit length.
+   * @param bytes The bytes to write.
+   * @throws An error if the file could not be written.
+   */
+  void cFile_Writer::Write_Bytes(std::string_view bytes) {
+    this->Write_Int32(bytes.length());
+    this->Write_Text(bytes);
+  }
+
+  /**
+   * Writes a line to the file.
+   * @param line The line to write.
+   * @throws An error if the file could not be written.
+   */
+  void cFile_Writer::Write_Line(std::string_view line) {
+    this->Write_Text(line);
+    this->End_Line();
+  }
+
+  /**
+   * Writes an object to the file in the same format as cFile.
+   * @param object The object to write.
+   * @throws An error if the file could not be written.
+   */
+  void cFile_Writer::Write_Object(tObject& object) {
+    int field_count = object.Count();
+    this->Write_Line("object");
+    for (int field_index = 0; field_index < field_count; field_index++) {
+      cValue& value = object.values[field_index];
+      if (value.type == eVALUE_NUMBER) {
+        this->Write_Text(object.keys[field_index]);
+        this->Write_Letter('=');
+        this->Write_Number(value.number);
+        this->End_Line();
+      }
+      else if (value.type == eVALUE_STRING) {
+        this->Write_Text(object.keys[field_index]);
+        this->Write_Letter('=');
+        this->Write_Line(value.string);
+      }
+    }
+    this->Write_Line("end");
+  }
+
+  /**
+   * Ends the current line.
+   * @throws An error if the file could not be written.
+   */
+  void cFile_Writer::End_Line() {
+    this->Write_Letter('\n');
+  }
+
+  /**
+   * Writes out everything in the buffer.
+   * @throws An error if the file could not be written.
+   */
+  void cFile_Writer::Flush() {
+    if (this->pointer > 0) {
+      this->file.write(this->buffer, this->pointer);
+      this->pointer = 0;
+      Check_Condition(this->file.good(), "Could not write file " + this->name + ".");
+    }
+  }
+
+  /**
+   * Finishes writing the file. An atomic file replaces the real file here.
+   * @throws An error if the file could not be written.
+   */
+  void cFile_Writer::Close() {
+    if (!this->closed) {
+      this->Flush();
+      this->file.close();
+      Check_Condition(!this->file.fail(), "Could not write file " + this->name + ".");
+      this->closed = true;
+      if (this->atomic) {
+#ifdef _WIN32
+        std::remove(this->name.c_str()); // Windows will not rename over a file.
+#endif
+        Check_Condition((std::rename(this->temp_name.c_str(), this->name.c_str()) == 0), "Could not replace file " + this->name + ".");
+      }
+    }
+  }
+
+  // **************************************************************************
+  // Config Module Implementation
+  // **************************************************************************
+
+  /**
+   * Creates a new config file.
+   * @param name The name of the config file.
+   * @throws An error if the config file could not be loaded.
+   */
+  cConfig::cConfig(std::string name) {
+    cFile config_file(name + ".txt");
+    config_file.Read();
+    int line_count = config_file.Count();
+    for (int line_index = 0; line_index < line_count; line_index++) {
+      std::string_view line = config_file.View_Line(line_index);
+      std::string_view pair[2];
+      if (cTokenizer(line, '=').Split(pair, 2) == 2) {
+        std::string name(pair[0]);
+        cValue value;
+        int number = 0;
+        if (Try_Text_To_Number(pair[1], number) == eNUMBER_OK) {
+          value.Set_Number(number);
+        }
+        else {
+          value.Set_String(std::string(pair[1]));
+        }
+        this->config[name] = std::move(value);
+      }
+    }
+  }
+
+  /**
+   * Gets a numeric property value.
+   * @param name The name of the property.
+   * @return The value of the property.
+   * @throws An error if the property does not exist.
+   */
+  int cConfig::Get_Property(std::string name) {
+    if (!this->config.Does_Key_Exist(name)) {
+      throw Nerd::cError("Property value " + name + " does not exist.");
+    }
+    return this->config[name].number;
+  }
+
+  /**
+   * Gets a string property value.
+   * @param name The name of the property.
+   * @return The value of the property. 
+   * @throws An error if the property does not exist.
+   */
+  std::string cConfig::Get_Text_Property(std::string name) {
+    Check_Condition(this->config.Does_Key_Exist(name), "Property value " + name + " does not exist.");
+    return this->config[name].string;
+  }
+
+  // **************************************************************************
+  // Value Implementation
+  // **************************************************************************
+
+  /**
+   * Creates a new value.
+   */
+  cValue::cValue() {
+    this->Set_Number(0);
+  }
+
+  /**
+   * Create a numeric value.
+   * @param number The numeric value.
+   */
+  cValue::cValue(int number) {
+    this->Set_Number(number);
+    this->string = Number_To_Text(number); // Also set string value.
+  }
+
+  /**
+   * Creates a string value.
+   * @param string The string value.
+   */
+  cValue::cValue(std::string string) {
+    if (Try_Text_To_Number(string, this->number) != eNUMBER_OK) {
+      this->number = 0;
+    }
+    this->Set_String(std::move(string));
+  }
+
+  /**
+   * Copies another value.
+   * @param other The other value.
+   */
+  cValue::cValue(const cValue& other) : type(other.type), number(other.number), string(other.string) {
+    // Nothing here.
+  }
+
+  /**
+   * Takes over another value. Its string is moved instead of copied.
+   * @param other The other value.
+   */
+  cValue::cValue(cValue&& other) : type(other.type), number(other.number), string(std::move(other.string)) {
+    // Nothing here.
+  }
+
+  /**
+   * Sets a numeric value.
+   * @param number The number.
+   */
+  void cValue::Set_Number(int number) {
+    this->type = eVALUE_NUMBER;
+    this->number = number;
+  }
+
+  /**
+   * Sets a string value.
+   * @param string The string value.
+   */
+  void cValue::Set_String(std::string string) {
+    this->type = eVALUE_STRING;
+    this->string = std::move(string);
+  }
+
+  /**
+   * Copies another value to this value.
+   * @param other The other value.
+   */
+  cValue& cValue::operator=(const cValue& other) {
+    this->type = other.type;
+    this->number = other.number;
+    this->string = other.string;
+    return (*this);
+  }
+
+  /**
+   * Moves another value into this value.
+   * @param other The other value.
+   */
+  cValue& cValue::operator=(cValue&& other) {
+    this->type = other.type;
+    this->number = other.number;
+    this->string = std::move(other.string);
+    return (*this);
+  }
+
+  /**
+   * Assigns a numeric value.
+   * @param number The numeric value.
+   */
+  void cValue::operator=(const int number) {
+    this->Set_Number(number);
+  }
+
+  /**
+   * Assigns a string value. It can be numeric which will convert it to a number.
+   * @param string The string value.
+   */
+  void cValue::operator=(const std::string string) {
+    int number = 0;
+    if (Try_Text_To_Number(string, number) == eNUMBER_OK) { // Try to convert to number.
+      this->Set_Number(number);
+    }
+    else {
+      this->Set_String(string);
+    }
+  }
+
+  /**
+   * Converts the value to numeric form.
+   */
+  void cValue::Convert_To_Number() {
+    this->number = Text_To_Number(this->string);
+  }
+
+  /**
+   * Converts the value to a string.
+   */
+  void cValue::Convert_To_String() {
+    this->string = Number_To_Text(this->number);
+  }
+
+  // **************************************************************************
+  // I/O Control Implementation
+  // **************************************************************************
+
+  /**
+   * Initializes the I/O control.
+   */
+  cIO_Control::cIO_Control() {
+    std::srand(std::time(NULL));
+    this->use_canvas = false;
+    this->width = 400;
+    this->height = 300;
+  }
+
+  /**
+   * Reads a signal from the signal buffer.
+   * @return The signal from the signal buffer.
+   */
+  sSignal cIO_Control::Read_Signal() {
+    sSignal signal = { eSIGNAL_NONE, 0, 0, eBUTTON_NONE };
+    if (this->signal_buffer.Count() > 0) {
+      signal = this->signal_buffer.Shift();
+    }
+    return signal;
+  }
+
+  /**
+   * Reads a key from the buffer. Leaves any other signals in.
+   * @return The read key or nothing.
+   */
+  sSignal cIO_Control::Read_Key() {
+    sSignal signal = { eSIGNAL_NONE, 0, 0, eBUTTON_NONE };
+    // Find a key signal.
+    int signal_count = this->signal_buffer.Count();
+    for (int signal_index = signal_count - 1; signal_index >= 0; signal_index--) { // Back to front.
+      if (this->signal_buffer[signal_index].code != eSIGNAL_MOUSE) {
+        signal = this->signal_buffer.Remove(signal_index);
+        break;
+      }
+    }
+    return signal;
+  }
+
+  /**
+   * Adds a key signal to the buffer.
+   * @param key The key to add.
+   */
+  void cIO_Control::Add_Key(int key) {
+    this->signal_buffer.Push({ key, 0, 0, eBUTTON_NONE });
+  }
+
+  /**
+   * Adds a mouse signal.
+   * @param button The pressed button or none.
+   * @param x The mouse x coordinate.
+   * @param y The mouse y coordinate.
+   */
+  void cIO_Control::Add_Mouse(int button, int x, int y) {
+    // std::cout << "button=" << button << ", x=" << x << ", y=" << y << std::endl;
+    this->signal_buffer.Push({ eSIGNAL_MOUSE, { x, y }, button});
+  }
+
+  /**
+   * Draws an image to the screen.
+   * @param name The name of the image.
+   * @param x The x coordinate.
+   * @param y The y coordinate.
+   * @param width The width of the image.
+   * @param height The height of the image.
+   * @param angle The angle in degrees.
+   * @param flip_x If set flips the image on the x-axis.
+   * @param flip_y If set flips the image on the y-axis.
+   */
+  void cIO_Control::Draw_Image(std::string name, int x, int y, int width, int height, int angle, bool flip_x, bool flip_y) {
+    // To be implemented in the app.
+  }
+
+  /**
+   * Draws the background canvas to the screen.
+   * @param x The x coordinate.
+   * @param y The y coordinate.
+   * @param width The width of the clipping rectangle.
+   * @param height The height of the clipping rectangle.
+   */
+  void cIO_Control::Draw_Canvas(int x, int y, int width, int height) {
+    // To be implemented in the app.
+  }
+
+  /**
+   * Outputs text to the screen.
+   * @param text The text to output.
+   * @param x The x coordinate.
+   * @param y The y coordinate.
+   * @param red The red component of the color.
+   * @param green The green component of the color.
+   * @param blue The blue component of the color.
+   */
+  void cIO_Control::Output_Text(std::string text, int x, int y, int red, int green, int blue) {
+    // To be implemented in the app.
+  }
+
+  /**
+   * Draws a box.
+   * @param x The x coordinate.
+   * @param y The y coordinate.
+   * @param width The width of the box.
+   * @param height The height of the box.
+   * @param red The red component.
+   * @param green The green component.
+   * @param blue The blue component.
+   */
+  void cIO_Control::Box(int x, int y, int width, int height, int red, int green, int blue) {
+    // To be implemented in the app.
+  }
+
+  /**
+   * Draw a frame.
+   * @param x The x coordinate.
+   * @param y The y coordinate.
+   * @param width The width of the box.
+   * @param height The height of the box.
+   * @param red The red component.
+   * @param green The green component.
+   * @param blue The blue component.
+   */
+  void cIO_Control::Frame(int x, int y, int width, int height, int red, int green, int blue) {
+    // To be implemented in app.
+  }
+
+  /**
+   * Plays a sound.
+   * @param name The name of the sound.
+   */
+  void cIO_Control::Play_Sound(std::string name) {
+    // To be implemented in the app.
+  }
+
+  /**
+   * Plays a music track.
+   * @param name The name of the music track.
+   */
+  void cIO_Control::Play_Music(std::string name) {
+    // To be implemented in the app.
+  }
+
+  /**
+   * Turns off the sounds playing.
+   */
+  void cIO_Control::Silence() {
+    // To be implemented in the app.
+  }
+
+  /**
+   * Delays execution for specified number of milliseconds.
+   * @param delay The number of milliseconds to delay execution.
+   */
+  void cIO_Control::Timeout(int delay) {
+    auto start = std::chrono::system_clock::now();
+    bool done = false;
+    while (!done) {
+      auto end = std::chrono::system_clock::now();
+      auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+      if (diff.count() >= delay) { // Time is up!
+        break;
+      }
+    }
+  }
+
+  /**
+   * Refreshes the screen.
+   */
+  void cIO_Control::Refresh() {
+    // To be implemented in the app.
+  }
+
+  /**
+   * Colors the screen.
+   * @param red The red component.
+   * @param green The green component.
+   * @param blue The blue component.
+   */
+  void cIO_Control::Color(int red, int green, int blue) {
+    // To be implemented in the app.
+  }
+
+  /**
+   * Causes the screen to update.
+   * param pp The picture processor.
+   */
+  void cIO_Control::Update_Display(cPicture_Processor* pp) {
+    // To be implemented in subclass.
+  }
+
+  /**
+   * Causes the screen to update from an 8-bit screen.
+   * param pp The picture processor.
+   */
+  void cIO_Control::Update_Display(tPicture_Processor_8* pp) {
+    // To be implemented in subclass.
+  }
+
+  /**
+   * Causes the screen to update from a 16-bit screen.
+   * param pp The picture processor.
+   */
+  void cIO_Control::Update_Display(tPicture_Processor_16* pp) {
+    // To be implemented in subclass.
+  }
+
+  /**
+   * Loads an array of objects from a file.
+   * @param name The name of the file.
+   * @param objects The array objects to load.
+   * @throws An error if the file could not be loaded.
+   */
+  void cIO_Control::Load(std::string name, cArray<tObject>& objects) {
+    cFile_Reader file(name);
+    while (file.Has_More_Lines()) {
+      tObject object;
+      file >>= object;
+      objects.Add(std::move(object));
+    }
+  }
+
+  /**
+   * Saves a file from a list of blocks.
+   * @param name The name of the file.
+   * @param objects The objects to save.
+   * @throws An error if the file could not be saved.
+   */
+  void cIO_Control::Save(std::string name, cArray<tObject>& objects) {
+    cFile_Writer file(name, true);
+    int obj_count = objects.Count();
+    for (int obj_index = 0; obj_index < obj_count; obj_index++) {
+      tObject& object = objects[obj_index];
+      file.Write_Object(object);
+    }
+    file.Close();
+  }
+
+  /**
+   * Loads a file into a matrix.
+   * @param name The name of the file.
+   * @param matrix The matrix to load.
+   * @throws An error if the file could not be loaded.
+   */
+  void cIO_Control::Load(std::string name, cMatrix& matrix) {
+    cFile_Reader file(name);
+    int width = 0;
+    int height = 0;
+    file >> width;
+    file >> height;
+    matrix.Resize(width, height);
+    for (int row_index = 0; row_index < height; row_index++) {
+      std::string_view line = file.View_Line();
+      cTokenizer tokenizer(line);
+      cList& row = matrix[row_index];
+      std::string_view token;
+      for (int col_index = 0; col_index < width; col_index++) {
+        Check_Condition(tokenizer.Next(token), "Invalid row width.");
+        row[col_index] = Text_To_Number(token);
+      }
+      Check_Condition(!tokenizer.Has_More_Tokens(), "Invalid row width.");
+    }
+  }
+
+  /**
+   * Saves a file from a matrix.
+   * @param name The name of the file.
+   * @param matrix The matrix to save.
+   * @throws An error if the file could not be saved.
+   */
+  void cIO_Control::Save(std::string name, cMatrix& matrix) {
+    cFile_Writer file(name, true);
+    for (int row_index = 0; row_index < matrix.height; row_index++) {
+      cList& row = matrix[row_index];
+      for (int col_index = 0; col_index < matrix.width; col_index++) {
+        file.Write_Number(row[col_index]);
+        if (col_index < (matrix.width - 1)) {
+          file.Write_Letter(' ');
+        }
+      }
+      file.End_Line();
+    }
+    file.Close();
+  }
+
+  /**
+   * Loads objects from a binary object file. The file holds the magic NRDO,
+   * the version, flags and the object count. If the dictionary flag is set a
+   * list of keys follows and fields refer to keys by index. Otherwise each
+   * field has its own key. Values are tagged with their eValue_Type. All
+   * numbers are 32-bit little endian and texts are length prefixed.
+   * @param name The name of the file.
+   * @param objects The objects to load.
+   * @throws An error if the file could not be loaded.
+   */
+  void cIO_Control::Load_Binary(std::string name, cArray<tObject>& objects) {
+    std::string data;
+    Read_File_Data(name, data);
+    cByte_Reader reader(data.data(), data.length());
+    Check_Condition((reader.Read_Bytes(4) == "NRDO"), "File " + name + " is not a binary object file.");
+    Check_Condition((reader.Read_Int32() == OBJECT_FILE_VERSION), "Unsupported object file version in " + name + ".");
+    int flags = reader.Read_Int32();
+    int obj_count = reader.Read_Int32();
+    Check_Condition((obj_count >= 0), "Invalid object count in " + name + ".");
+    cVector<std::string> keys;
+    bool use_dictionary = ((flags & eOBJECT_FILE_DICTIONARY) != 0);
+    if (use_dictionary) {
+      int key_count = reader.Read_Int32();
+      Check_Condition((key_count >= 0), "Invalid key count in " + name + ".");
+      keys.Reserve(key_count);
+      for (int key_index = 0; key_index < key_count; key_index++) {
+        keys.Add(std::string(reader.Read_Text()));
+      }
+    }
+    for (int obj_index = 0; obj_index < obj_count; obj_index++) {
+      tObject object;
+      int field_count = reader.Read_Int32();
+      for (int field_index = 0; field_index < field_count; field_index++) {
+        std::string key;
+        if (use_dictionary) {
+          int key_id = reader.Read_Int32();
+          Check_Condition(((key_id >= 0) && (key_id < keys.Count())), "Invalid key in " + name + ".");
+          key = keys.At_Unchecked(key_id);
+        }
+        else {
+          key = reader.Read_Text();
+        }
+        int type = reader.Read_Byte();
+        if (type == eVALUE_NUMBER) {
+          object.Add(std::move(key), cValue(reader.Read_Int32()));
+        }
+        else if (type == eVALUE_STRING) {
+          object.Add(std::move(key), cValue(std::string(reader.Read_Text())));
+        }
+        else {
+          throw cError("Invalid value type in " + name + ".");
+        }
+      }
+      objects.Add(std::move(object));
+    }
+  }
+
+  /**
+   * Saves objects to a binary object file with a key dictionary.
+   * @param name The name of the file.
+   * @param objects The objects to save.
+   * @throws An error if the file could not be saved.
+   */
+  void cIO_Control::Save_Binary(std::string name, cArray<tObject>& objects) {
+    this->Save_Binary(name, objects, true);
+  }
+
+  /**
+   * Saves objects to a binary object file.
+   * @param name The name of the file.
+   * @param objects The objects to save.
+   * @param use_dictionary True if keys are stored once in a dictionary.
+   * @throws An error if the file could not be saved.
+   */
+  void cIO_Control::Save_Binary(std::string name, cArray<tObject>& objects, bool use_dictionary) {
+    cFile_Writer file(name, true);
+    int obj_count = objects.Count();
+    file.Write_Text("NRDO");
+    file.Write_Int32(OBJECT_FILE_VERSION);
+    file.Write_Int32(use_dictionary ? eOBJECT_FILE_DICTIONARY : 0);
+    file.Write_Int32(obj_count);
+    cHash<std::string, int> key_ids;
+    if (use_dictionary) {
+      for (int obj_index = 0; obj_index < obj_count; obj_index++) {
+        tObject& object = objects[obj_index];
+        int field_count = object.Count();
+        for (int field_index = 0; field_index < field_count; field_index++) {
+          std::string& key = object.keys[field_index];
+          if (!key_ids.Does_Key_Exist(key)) {
+            key_ids.Add(key, key_ids.Count());
+          }
+        }
+      }
+      int key_count = key_ids.Count();
+      file.Write_Int32(key_count);
+      for (int key_index = 0; key_index < key_count; key_index++) {
+        file.Write_Bytes(key_ids.keys[key_index]);
+      }
+    }
+    for (int obj_index = 0; obj_index < obj_count; obj_index++) {
+      tObject& object = objects[obj_index];
+      int field_count = object.Count();
+      file.Write_Int32(field_count);
+      for (int field_index = 0; field_index < field_count; field_index++) {
+        std::string& key = object.keys[field_index];
+        cValue& value = object.values[field_index];
+        if (use_dictionary) {
+          file.Write_Int32(key_ids[key]);
+        }
+        else {
+          file.Write_Bytes(key);
+        }
+        file.Write_Letter((char)value.type);
+        if (value.type == eVALUE_NUMBER) {
+          file.Write_Int32(value.number);
+        }
+        else {
+          file.Write_Bytes(value.string);
+        }
+      }
+    }
+    file.Close();
+  }
+
+  /**
+   * Converts a text object file to a binary object file.
+   * @param text_name The name of the text object file.
+   * @param binary_name The name of the binary object file to create.
+   * @throws An error if the file could not be converted.
+   */
+  void cIO_Control::Convert_To_Binary(std::string text_name, std::string binary_name) {
+    cArray<tObject> objects;
+    this->Load(text_name, objects);
+    this->Save_Binary(binary_name, objects);
+  }
+
+  /**
+   * Gets a new random number.
+   * @param lower The lower bound.
+   * @param upper The upper bound.
+   * @return The random number.
+   */
+  int cIO_Control::Get_Random_Number(int lower, int upper) {
+    return (lower + ((std::rand() << 8) % (upper - lower + 1)));
+  }
+
+  /**
+   * Gets the width of the text.
+   * @param text The text to measure.
+   * @return The width of the text.
+   */
+  int cIO_Control::Get_Text_Width(std::string text) {
+    // To be implemented in app.
+    return 0;
+  }
+
+  /**
+   * Gets the height of the text.
+   * @param text The text to measure.
+   * @return The height of the text.
+   */
+  int cIO_Control::Get_Text_Height(std::string text) {
+    // To be implemented in app.
+    return 0;
+  }
+
+  /**
+   * Sets the canvas mode based on the flag.
+   */
+  void cIO_Control::Set_Canvas_Mode() {
+    // To be implemented in app.
+  }
+
+  /**
+   * Sets the screen drawing mode.
+   */
+  void cIO_Control::Set_Screen_Target() {
+    this->use_canvas = false;
+  }
+
+  /**
+   * Sets the canvas drawing mode.
+   */
+  void cIO_Control::Set_Canvas_Target() {
+    this->use_canvas = true;
+  }
+
+  /**
+   * Gets the width of the image.
+   * @param name The name of the image.
+   * @return The width of the image in pixels.
+   */
+  int cIO_Control::Get_Image_Width(std::string name) {
+    // To be implemented in app.
+    return 0;
+  }
+
+  /**
+   * Gets the height of the image.
+   * @param name The name of the image.
+   * @return The height of the image in pixels.
+   */
+  int cIO_Control::Get_Image_Height(std::string name) {
+    // To be implemented in app.
+    return 0;
+  }
+
+  /**
+   * Gets a list of files from a directory path.
+   * @param path The path to browse.
+   * @return A list of files in the folder.
+   */
+  cArray<std::string> cIO_Control::Get_File_List(std::string path) {
+    // To be implemented in the app.
+    cArray<std::string> files;
+    return files;
+  }
+
+  /**
+   * Gets the current folder where the app is running.
+   * @return The folder path.
+   */
+  std::string cIO_Control::Get_Current_Folder() {
+    return "";
+  }
+
+  /**
+   * Gets the extension of a file based on the path.
+   * @param path The file path.
+   * @return The file extension.
+   */
+  std::string cIO_Control::Get_File_Extension(std::string path) {
+    // To be implemented in the app.
+    return "";
+  }
+
+  /**
+   * Gets the title of the file.
+   * @param path The file path.
+   * @return The file title which is the base name.
+   */
+  std::string cIO_Control::Get_File_Title(std::string path) {
+    // To be implemented in the app.
+    return "";
+  }
+
+  /**
+   * Gets the name of the file.
+   * @param path The file path.
+   * @return The name of the file.
+   */
+  std::string cIO_Control::Get_File_Name(std::string path) {
+    // To be implemented in the app.
+    return "";
+  }
+
+  // **************************************************************************
+  // List Implementation
+  // **************************************************************************
+
+  /**
+   * Creates a list with one item.
+   */
+  cList::cList() {
+    this->items.Add(0);
+  }
+
+  /**
+   * Creates a new list of the specified size.
+   * @param size The size of the list.
+   */
+  cList::cList(int size) {
+    this->items.Reserve(size);
+    for (int item_index = 0; item_index < size; item_index++) {
+      this->items.Add(0);
+    }
+  }
+
+  /**
+   * Copies another list.
+   * @param other The other list.
+   */
+  cList::cList(const cList& other) : items(other.items) {
+    // Nothing here.
+  }
+
+  /**
+   * Takes over the items of another list.
+   * @param other The other list.
+   */
+  cList::cList(cList&& other) : items(std::move(other.items)) {
+    // Nothing here.
+  }
+
+  /**
+   * Accesses the item at the index.
+   * @param index The index of the item.
+   * @return The reference to the item.
+   * @throws An error if the index is out of bounds.
+   */
+  int& cList::operator[](int index) {
+    if ((index < 0) || (index >= this->items.Count())) {
+      throw cError("List index is out of bounds.");
+    }
+    return this->items.At_Unchecked(index);
+  }
+
+  /**
+   * Assigns a list to another.
+   * @param other The other list.
+   * @return This list.
+   */
+  cList& cList::operator=(const cList& other) {
+    this->items = other.items;
+    return (*this);
+  }
+
+  /**
+   * Moves a list into this one.
+   * @param other The other list.
+   * @return This list.
+   */
+  cList& cList::operator=(cList&& other) {
+    this->items = std::move(other.items);
+    return (*this);
+  }
+
+  /**
+   * Clears out the list.
+   */
+  void cList::Clear() {
+    int item_count = this->items.Count();
+    for (int item_index = 0; item_index < item_count; item_index++) {
+      this->items[item_index] = 0;
+    }
+  }
+
+  /**
+   * Adds a value to the list.
+   * @param value The value to add.
+   */
+  void cList::Add(int value) {
+    this->items.Add(value);
+  }
+
+  /**
+   * Removes an item from the list.
+   * @param index The index of the item.
+   * @throws An error if the index is invalid.
+   */
+  void cList::Remove(int index) {
+    if ((index < 0) || (index >= this->items.Count())) {
+      throw cError("Invalid index.");
+    }
+    this->items.Remove(index);
+  }
+
+  /**
+   * Gets the count of the items.
+   * @return The number of items.
+   */
+  int cList::Count() {
+    return this->items.Count();
+  }
+
+  // **************************************************************************
+  // Matrix Implementation
+  // **************************************************************************
+
+  /**
+   * Creates a 1x1 matrix.
+   */
+  cMatrix::cMatrix() {
+    this->Resize(1, 1);
+  }
+
+  /**
+   * Creates a new matrix with a specified size.
+   * @param width The width of the matrix.
+   * @param height The height of the matrix.
+   */
+  cMatrix::cMatrix(int width, int height) {
+    this->Resize(width, height);
+  }
+
+  /**
+   * Copies another matrix.
+   * @param other The other matrix.
+   */
+  cMatrix::cMatrix(const cMatrix& other) : width(other.width), height(other.height), rows(other.rows) {
+    // Nothing here.
+  }
+
+  /**
+   * Takes over the rows of another matrix.
+   * @param other The other matrix.
+   */
+  cMatrix::cMatrix(cMatrix&& other) : width(other.width), height(other.height), rows(std::move(other.rows)) {
+    other.width = 0;
+    other.height = 0;
+  }
+
+  /**
+   * Gets the list at the index.
+   * @param index The index of the list.
+   * @return The list reference.
+   * @throws An error if the index is out of bounds.
+   */
+  cList& cMatrix::operator[](int index) {
+    if ((index < 0) || (index >= this->height)) {
+      throw cError("Index is out of bounds for matrix.");
+    }
+    return this->rows.At_Unchecked(index);
+  }
+
+  /**
+   * Assigns another matrix to this one.
+   * @param other The other matrix.
+   * @return This matrix.
+   */
+  cMatrix& cMatrix::operator=(const cMatrix& other) {
+    this->width = other.width;
+    this->height = other.height;
+    this->rows = other.rows;
+    return (*this);
+  }
+
+  /**
+   * Moves another matrix into this one.
+   * @param other The other matrix.
+   * @return This matrix.
+   */
+  cMatrix& cMatrix::operator=(cMatrix&& other) {
+    std::swap(this->width, other.width);
+    std::swap(this->height, other.height);
+    this->rows = std::move(other.rows);
+    return (*this);
+  }
+
+  /**
+   * Clears out the matrix.
+   */
+  void cMatrix::Clear() {
+    int row_count = this->rows.Count();
+    for (int row_index = 0; row_index < row_count; row_index++) {
+      this->rows[row_index].Clear();
+    }
+  }
+
+  /**
+   * Resizes the matrix.
+   * @param width The new width.
+   * @param height The new height.
+   */
+  void cMatrix::Resize(int width, int height) {
+    this->width = width;
+    this->height = height;
+    this->rows.Clear();
+    for (int row_index = 0; row_index < height; row_index++) {
+      this->rows.Add(cList(width));
+    }
+  }
+
+  // **************************************************************************
+  // Terminal Implementation
+  // **************************************************************************
+
+  /**
+   * Creates a new terminal.
+   * @param width The width of the terminal, in characters.
+   * @param height The height of the terminal, in characters.
+   * @param letter_w The width of a single letter.
+   * @param letter_h The height of a single letter.
+   * @param io The I/O control.
+   */
+  cTerminal::cTerminal(int width, int height, int letter_w, int letter_h, cIO_Control* io) {
+    this->width = width;
+    this->height = height;
+    this->letter_w = letter_w;
+    this->letter_h = letter_h;
+    this->red = 0;
+    this->green = 0;
+    this->blue = 0;
+    this->io = io;
+    this->status = eSTATUS_OUTPUT;
+    this->counter = 0;
+    // Add first line.
+    this->lines.Add(tLine());
+    // Add time stamp.
+    this->time_stamp = std::chrono::system_clock::now();
+    this->scroll_x = 0;
+    this->scroll_y = 0;
+  }
+
+  /**
+   * Writes a letter to the line buffer.
+   * @param letter The letter to write.
+   */
+  void cTerminal::Write_Letter(int letter) {
+    if (letter == '\n') {
+      this->lines.Add(tLine()); // Push in new line.
+      if (this->lines.Count() > this->height) {
+        this->scroll_y++;
+      }
+    }
+    else {
+      tLine& last_line = this->lines.Peek_Back(); // Get last line.
+      sLetter l;
+      l.letter = letter;
+      l.red = this->red;
+      l.green = this->green;
+      l.blue = this->blue;
+      last_line.Add(l);
+    }
+  }
+
+  /**
+   * Writes a string to the terminal.
+   * @param text The text to output to the terminal.
+   */
+  void cTerminal::Write_String(std::string text) {
+    int letter_count = text.length();
+    for (int letter_index = 0; letter_index < letter_count; letter_index++) {
+      this->Write_Letter(text[letter_index]);
+    }
+  }
+
+  /**
+   * Sets the color of the terminal text.
+   * @param red The red component.
+   * @param green The green component.
+   * @param blue The blue component.
+   */
+  void cTerminal::Set_Color(int red, int green, int blue) {
+    this->red = red;
+    this->green = green;
+    this->blue = blue;
+  }
+
+  /**
+   * This clears out the terminal.
+   */
+  void cTerminal::Clear() {
+    this->lines.Clear();
+  }
+
+  /**
+   * Reads input from the user. Stops when enter is hit.
+   */
+  void cTerminal::Read_Input() {
+    if (this->status != eSTATUS_INPUT) {
+      this->status = eSTATUS_INPUT;
+      this->Set_Color(0, 128, 0);
+      this->Write_String(": ");
+    }
+  }
+
+  /**
+   * Processes keys.
+   */
+  void cTerminal::Process_Keys() {
+    sSignal key = this->io->Read_Key();
+    switch (key.code) {
+      case eSIGNAL_ENTER: {
+        if (this->status == eSTATUS_INPUT) {
+          this->Write_Letter('\n');
+          this->Set_Error_Mode(false);
+          this->On_Read(this->Buffer_To_String());
+        }
+        break;
+      }
+      case eSIGNAL_BACKSPACE: {
+        this->Backspace();
+        break;
+      }
+      case eSIGNAL_LEFT: {
+        if (this->scroll_x > 0) {
+          this->scroll_x--;
+        }
+        break;
+      }
+      case eSIGNAL_RIGHT: {
+        this->scroll_x++;
+        break;
+      }
+      case eSIGNAL_UP: {
+        if (this->scroll_y > 0) {
+          this->scroll_y--;
+        }
+        break;
+      }
+      case eSIGNAL_DOWN: {
+        this->scroll_y++;
+        break;
+      }
+      default: { // Any character.
+        if ((key.code >= ' ') && (key.code <= '~')) { // Data characters.
+          if (this->status == eSTATUS_INPUT) {
+            this->Write_Letter(key.code);
+            this->input_buffer.Push(key.code);
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Renders the terminal screen.
+   */
+  void cTerminal::Render() {
+    // Clear the screen.
+    this->io->Color(255, 255, 255);
+    // Render current screenfull of lines.
+    int row_index = 0;
+    for (tLine& line : this->lines) {
+      int letter_index = 0;
+      for (sLetter& letter : line) {
+        char buffer[2] = { (char)letter.letter, 0 };
+        this->io->Output_Text(buffer, (letter_index - this->scroll_x) * this->letter_w, (row_index - this->scroll_y) * this->letter_h, letter.red, letter.green, letter.blue);
+        letter_index++;
+      }
+      row_index++;
+    }
+    // Draw the cursor.
+    if (this->status == eSTATUS_INPUT) {
+      auto now = std::chrono::system_clock::now();
+      auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(now - this->time_stamp);
+      if (diff.count() >= BLINK_RATE) {
+        this->time_stamp = std::chrono::system_clock::now();
+        this->counter++;
+      }
+      if ((this->counter % 2) == 0) {
+        int x = (this->lines.Peek_Back().Count() > 0) ? this->lines.Peek_Back().Count() - 1 : 0;
+        int y = this->lines.Count() - 1;
+        this->io->Box((x + 1 - this->scroll_x) * this->letter_w, (y - this->scroll_y) * this->letter_h, this->letter_w, this->letter_h, 0, 0, 0);
+      }
+    }
+    // Refresh the screen.
+    this->io->Refresh();
+  }
+
+  /**
+   * Backspaces a character out.
+   */
+  void cTerminal::Backspace() {
+    if (this->status == eSTATUS_INPUT) {
+      if (this->input_buffer.Count() > 0) {
+        tLine& line = this->lines.Peek_Back();
+        if (line.Count() > 0) {
+          line.Pop(); // Remove character.
+          this->input_buffer.Pop(); // Remove from input buffer as well.
+        }
+      }
     }
   }
 
@@ -1518,533 +3445,1962 @@ namespace Nerd {
    * Called when the input has been read.
    * @param text The text that was read.
    */
-  void cTerminal::On_Read(std::string text) {
-    // To be implemented in app.
+  void cTerminal::On_Read(std::string text) {
+    // To be implemented in app.
+  }
+
+  /**
+   * Converts the buffer to a string.
+   * @return The text from the buffer.
+   */
+  std::string cTerminal::Buffer_To_String() {
+    std::string text = "";
+    text.reserve(this->input_buffer.Count());
+    while (this->input_buffer.Count() > 0) {
+      int letter = this->input_buffer.Shift();
+      text += (char)letter;
+    }
+    return text;
+  }
+
+  /**
+   * Sets the error mode.
+   * @param error If true then error mode is set, otherwise it is set to output.
+   */
+  void cTerminal::Set_Error_Mode(bool error) {
+    if (error) {
+      this->status = eSTATUS_ERROR;
+      this->Set_Color(128, 0, 0);
+    }
+    else {
+      this->status = eSTATUS_OUTPUT;
+      this->Set_Color(0, 0, 0);
+    }
+  }
+
+  // **************************************************************************
+  // Parameters Implementation
+  // **************************************************************************
+
+  /**
+   * Parses the incoming parameters and creates a new parameter object.
+   * @param argc The number of arguments in the command line.
+   * @param argv The argument vector.
+   * @param names The names of the parameters.
+   * @throws An error if there are parameters missing.
+   */
+  cParameters::cParameters(int argc, char** argv, cArray<std::string> names) {
+    int param_count = names.Count();
+    Check_Condition((argc == (param_count + 1)), "Missing parameters! Arguments are: " + Join(names, " ")); // Accounts for program name.
+    for (int arg_index = 1; arg_index < argc; arg_index++) { // Don't want first parameter.
+      std::string name = names[arg_index - 1];
+      std::string param = argv[arg_index];
+      cValue value;
+      int number = 0;
+      if (Try_Text_To_Number(param, number) == eNUMBER_OK) {
+        value.Set_Number(number);
+      }
+      else {
+        value.Set_String(param);
+      }
+      this->params[name] = std::move(value);
+    }
+  }
+
+  /**
+   * Gets the parameter value given the name.
+   * @param name The name of the parameter to retrieve.
+   * @return The value at the parameter.
+   * @throws An error if the parameter does not exist.
+   */
+  cValue& cParameters::operator[] (std::string name) {
+    Check_Condition(this->params.Does_Key_Exist(name), "Parameter " + name + " does not exist.");
+    return this->params[name];
+  }
+
+  // **************************************************************************
+  // Table Implementation
+  // **************************************************************************
+
+  /**
+   * Creates a new table of the specified width and height. The rows live in
+   * one aligned buffer and each row starts a stride apart.
+   * @param width The width of the table.
+   * @param height The height of the table.
+   */
+  template <typename T> cBasic_Table<T>::cBasic_Table(int width, int height) {
+    this->width = 0;
+    this->height = 0;
+    this->row_pointer = 0;
+    this->col_pointer = 0;
+    this->rows = NULL;
+    this->data = NULL;
+    this->stride = 0;
+    this->mapping = NULL;
+    this->mapping_size = 0;
+    this->Allocate_Rows(width, height);
+  }
+
+  /**
+   * Copies another table.
+   * @param other The other table.
+   */
+  template <typename T> cBasic_Table<T>::cBasic_Table(const cBasic_Table<T>& other) {
+    this->width = 0;
+    this->height = 0;
+    this->rows = NULL;
+    this->data = NULL;
+    this->stride = 0;
+    this->mapping = NULL;
+    this->mapping_size = 0;
+    (*this) = other;
+  }
+
+  /**
+   * Takes over the rows of another table. The other table is left empty.
+   * @param other The other table.
+   */
+  template <typename T> cBasic_Table<T>::cBasic_Table(cBasic_Table<T>&& other) {
+    this->width = other.width;
+    this->height = other.height;
+    this->row_pointer = other.row_pointer;
+    this->col_pointer = other.col_pointer;
+    this->rows = other.rows;
+    this->data = other.data;
+    this->stride = other.stride;
+    this->mapping = other.mapping;
+    this->mapping_size = other.mapping_size;
+    other.width = 0;
+    other.height = 0;
+    other.row_pointer = 0;
+    other.col_pointer = 0;
+    other.rows = NULL;
+    other.data = NULL;
+    other.stride = 0;
+    other.mapping = NULL;
+    other.mapping_size = 0;
+  }
+
+  /**
+   * Frees up the table.
+   */
+  template <typename T> cBasic_Table<T>::~cBasic_Table() {
+    this->Free_Rows();
+  }
+
+  /**
+   * Moves to the next row.
+   * @throws An error if are no more rows to move to.
+   */
+  template <typename T> void cBasic_Table<T>::Move_To_Next_Row() {
+    if (this->row_pointer < this->height) {
+      this->row_pointer++;
+      this->col_pointer = 0; // Reset column pointer.
+    }
+    else {
+      throw cError("No more rows to move to!");
+    }
+  }
+
+  /**
+   * Reads a single column from the table.
+   * @return The numeric value of the column.
+   * @throws An error if there are no more columns to read.
+   */
+  template <typename T> T cBasic_Table<T>::Read_Column() {
+    T value = 0;
+    if (this->col_pointer < this->width) {
+      value = this->rows[this->row_pointer][this->col_pointer];
+      this->col_pointer++;
+    }
+    else {
+      throw cError("No more columns to read!");
+    }
+    return value;
+  }
+
+  /**
+   * Moves to a specified column.
+   * @param index The index of the column to move to.
+   * @throws An error if the index is out of bounds.
+   */
+  template <typename T> void cBasic_Table<T>::Move_To_Column(int index) {
+    if ((index >= 0) && (index < this->width)) {
+      this->col_pointer = index;
+    }
+    else {
+      throw cError("Column is out of bounds.");
+    }
+  }
+
+  /**
+   * Writes a value to a column.
+   * @param value The value to write to the column.
+   * @throws An error if there are no more columns to write to.
+   */
+  template <typename T> void cBasic_Table<T>::Write_Column(T value) {
+    if (this->col_pointer < this->width) {
+      this->rows[this->row_pointer][this->col_pointer] = value;
+      this->col_pointer++;
+    }
+    else {
+      throw cError("No more columns to write to!");
+    }
+  }
+
+  /**
+   * Rewinds the pointers to read and write from the beginning of the table.
+   */
+  template <typename T> void cBasic_Table<T>::Rewind() {
+    this->row_pointer = 0;
+    this->col_pointer = 0;
+  }
+
+  /**
+   * Allows a table to be assigned to another table. The buffer is reused if
+   * the size matches. Tables with the same stride are copied in one go.
+   * @param other The other table to assign from.
+   * @return The reference to this table.
+   */
+  template <typename T> cBasic_Table<T>& cBasic_Table<T>::operator=(const cBasic_Table<T>& other) {
+    if (this == &other) {
+      return (*this);
+    }
+    if ((this->width != other.width) || (this->height != other.height) || this->mapping || !this->data) {
+      this->Allocate_Rows(other.width, other.height);
+    }
+    this->row_pointer = 0;
+    this->col_pointer = 0;
+    if (this->stride == other.stride) {
+      std::memcpy(this->data, other.data, (std::size_t)this->stride * this->height * sizeof(T));
+    }
+    else {
+      for (int row_index = 0; row_index < this->height; row_index++) {
+        std::memcpy(this->rows[row_index], other.rows[row_index], this->width * sizeof(T));
+      }
+    }
+    return (*this);
+  }
+
+  /**
+   * Swaps rows with another table that is about to go away.
+   * @param other The other table.
+   * @return The reference to this table.
+   */
+  template <typename T> cBasic_Table<T>& cBasic_Table<T>::operator=(cBasic_Table<T>&& other) {
+    std::swap(this->width, other.width);
+    std::swap(this->height, other.height);
+    std::swap(this->rows, other.rows);
+    std::swap(this->data, other.data);
+    std::swap(this->stride, other.stride);
+    std::swap(this->mapping, other.mapping);
+    std::swap(this->mapping_size, other.mapping_size);
+    this->row_pointer = 0;
+    this->col_pointer = 0;
+    return (*this);
+  }
+
+  /**
+   * Clears out the table's rows.
+   */
+  template <typename T> void cBasic_Table<T>::Clear() {
+    this->Fill(0);
+  }
+
+  /**
+   * Moves to a specific row.
+   * @param index The index of the row to move to.
+   * @throws An error if the row does not exist.
+   */
+  template <typename T> void cBasic_Table<T>::Move_To_Row(int index) {
+    if ((index >= 0) && (index < this->height)) {
+      this->row_pointer = index;
+      this->col_pointer = 0;
+    }
+    else {
+      throw cError("Invalid row access at " + Number_To_Text(index) + ".");
+    }
+  }
+
+  /**
+   * Loads a file into a table.
+   * @param name The name of the file.
+   * @throws An error if the file could not be loaded.
+   */
+  template <typename T> void cBasic_Table<T>::Load_From_File(std::string name) {
+    cFile file(name);
+    file.Read();
+    this->Rewind();
+    // Read dimensions.
+    std::string dimensions = file.Get_Line();
+    std::string_view pair[2];
+    if (cTokenizer(dimensions, 'x').Split(pair, 2) == 2) {
+      int width = Text_To_Number(pair[0]);
+      int height = Text_To_Number(pair[1]);
+      this->Resize(width, height); // Resize the table to fit the data.
+      // Read the table data.
+      while (file.Has_More_Lines()) {
+        std::string line = file.Get_Line();
+        cTokenizer columns(line, ' ');
+        std::string_view column;
+        while (columns.Next(column)) {
+          int number = Text_To_Number(column);
+          if ((sizeof(T) < sizeof(int)) && (number != (T)number)) { // Int cells hold any number.
+            throw cError("Number " + std::string(column) + " does not fit in a column of " + name + ".");
+          }
+          this->Write_Column(number);
+        }
+        this->Move_To_Next_Row();
+      }
+      this->Rewind(); // Rewind after loading.
+    }
+    else {
+      throw cError("Missing width or height in " + name + ".");
+    }
+  }
+
+  /**
+   * Saves a table to a file. The first line holds the dimensions so the file
+   * can be loaded back with Load_From_File.
+   * @param name The name of the file to save to.
+   */
+  template <typename T> void cBasic_Table<T>::Save_To_File(std::string name) {
+    cFile_Writer file(name, true);
+    this->Rewind();
+    file.Write_Number(this->width);
+    file.Write_Letter('x');
+    file.Write_Number(this->height);
+    file.End_Line();
+    for (int row_index = 0; row_index < this->height; row_index++) {
+      T* row = this->rows[row_index];
+      for (int col_index = 0; col_index < this->width; col_index++) {
+        file.Write_Number(row[col_index]);
+        if (col_index < (this->width - 1)) {
+          file.Write_Letter(' ');
+        }
+      }
+      file.End_Line();
+    }
+    file.Close();
+  }
+
+  /**
+   * Loads a binary table file. The file is mapped copy-on-write so changes to
+   * the table never reach the file.
+   * @param name The name of the file.
+   * @throws An error if the file could not be loaded.
+   */
+  template <typename T> void cBasic_Table<T>::Load_From_Binary_File(std::string name) {
+    this->Load_From_Binary_File(name, eTABLE_MAP_COPY_ON_WRITE);
+  }
+
+  /**
+   * Loads a binary table file. Where memory mapping is available and the
+   * cells in the file have the size of the table's cells the file itself
+   * becomes the table's storage. Only the row pointers are built, so loading
+   * does not depend on the size of the table. Pages are read in as they are
+   * touched. A read only table must not be written to. Otherwise the file is
+   * read in one go and the cells are converted.
+   * @param name The name of the file.
+   * @param mode Whether the mapping is read only or copy-on-write.
+   * @throws An error if the file could not be loaded.
+   */
+  template <typename T> void cBasic_Table<T>::Load_From_Binary_File(std::string name, eTable_Mapping mode) {
+    int width = 0;
+    int height = 0;
+    int cell_size = 0;
+#ifndef _WIN32
+    if (Is_Little_Endian()) {
+      int handle = open(name.c_str(), O_RDONLY);
+      Check_Condition((handle != -1), "Could not read file " + name + ".");
+      struct stat info;
+      if (fstat(handle, &info) == -1) {
+        close(handle);
+        throw cError("Could not read file " + name + ".");
+      }
+      std::size_t size = info.st_size;
+      int protection = (mode == eTABLE_MAP_READ_ONLY) ? PROT_READ : (PROT_READ | PROT_WRITE);
+      void* mapping = (size > 0) ? mmap(NULL, size, protection, MAP_PRIVATE, handle, 0) : MAP_FAILED;
+      close(handle); // The mapping keeps the file open.
+      Check_Condition((mapping != MAP_FAILED), "File " + name + " is not a binary table file.");
+      int offset = 0;
+      try {
+        offset = Read_Table_Header((const char*)mapping, size, name, width, height, cell_size);
+      }
+      catch (cError& map_error) {
+        munmap(mapping, size);
+        throw;
+      }
+      if (cell_size == sizeof(T)) {
+        this->Free_Rows();
+        this->width = width;
+        this->height = height;
+        this->mapping = mapping;
+        this->mapping_size = size;
+        this->data = (T*)((char*)mapping + offset);
+        this->stride = width;
+        this->rows = new T* [height];
+        for (int row_index = 0; row_index < height; row_index++) {
+          this->rows[row_index] = this->data + ((std::size_t)row_index * width);
+        }
+        this->Rewind();
+        return;
+      }
+      munmap(mapping, size); // Cells need to be converted.
+    }
+#endif
+    std::string data;
+    Read_File_Data(name, data);
+    int offset = Read_Table_Header(data.data(), data.length(), name, width, height, cell_size);
+    cByte_Reader reader(data.data() + offset, data.length() - offset);
+    this->Resize(width, height);
+    for (int row_index = 0; row_index < height; row_index++) {
+      T* row = this->rows[row_index];
+      for (int col_index = 0; col_index < width; col_index++) {
+        int value = 0;
+        if (cell_size == 1) {
+          value = reader.Read_Byte();
+        }
+        else if (cell_size == 2) {
+          value = reader.Read_Byte();
+          value |= reader.Read_Byte() << 8;
+        }
+        else {
+          value = reader.Read_Int32();
+        }
+        if ((sizeof(T) < sizeof(int)) && (value != (T)value)) {
+          throw cError("Number " + Number_To_Text(value) + " does not fit in a column of " + name + ".");
+        }
+        row[col_index] = value;
+      }
+    }
+    this->Rewind();
+  }
+
+  /**
+   * Saves a table to a binary table file that can be mapped by
+   * Load_From_Binary_File. The cells keep the size they have in the table.
+   * @param name The name of the file.
+   * @throws An error if the file could not be saved.
+   */
+  template <typename T> void cBasic_Table<T>::Save_To_Binary_File(std::string name) {
+    cFile_Writer file(name, true);
+    file.Write_Text("NRDT");
+    file.Write_Int32(TABLE_FILE_VERSION);
+    file.Write_Int32(sizeof(T));
+    file.Write_Int32(this->width);
+    file.Write_Int32(this->height);
+    bool little_endian = Is_Little_Endian();
+    for (int row_index = 0; row_index < this->height; row_index++) {
+      T* row = this->rows[row_index];
+      if (little_endian) {
+        file.Write_Text(std::string_view((const char*)row, this->width * sizeof(T)));
+      }
+      else {
+        for (int col_index = 0; col_index < this->width; col_index++) {
+          unsigned int bits = row[col_index];
+          for (int byte_index = 0; byte_index < (int)sizeof(T); byte_index++) {
+            file.Write_Letter((char)((bits >> (byte_index * 8)) & 0xFF));
+          }
+        }
+      }
+    }
+    file.Close();
+  }
+
+  /**
+   * Determines if the table is backed by a mapped file.
+   * @return True if the table is mapped, false otherwise.
+   */
+  template <typename T> bool cBasic_Table<T>::Is_Mapped() {
+    return (this->mapping != NULL);
+  }
+
+  /**
+   * Resizes the table to a new width and height. The table is cleared.
+   * @param width The new width of the table.
+   * @param height The new height of the table.
+   */
+  template <typename T> void cBasic_Table<T>::Resize(int width, int height) {
+    if ((width == this->width) && (height == this->height) && this->data && !this->mapping) {
+      this->Clear();
+    }
+    else {
+      this->Allocate_Rows(width, height);
+    }
+    this->Rewind();
+  }
+
+  /**
+   * Dumps the contents of a table to the console.
+   */
+  template <typename T> void cBasic_Table<T>::Dump() {
+    std::cout << "table=" << this->width << "x" << this->height << std::endl;
+    std::cout << "row-pointer=" << this->row_pointer << std::endl;
+    std::cout << "col-pointer=" << this->col_pointer << std::endl;
+    std::cout << "*** data ***" << std::endl;
+    for (int row_index = 0; row_index < this->height; row_index++) {
+      for (int col_index = 0; col_index < this->width; col_index++) {
+        std::cout << (int)this->rows[row_index][col_index];
+        if (col_index < (this->width - 1)) {
+          std::cout << " ";
+        }
+      }
+      std::cout << std::endl;
+    }
+  }
+
+  /**
+   * Fills every column of the table with a value. The padding at the end of
+   * each row is filled too so the buffer is written in one sweep.
+   * @param value The value to fill with.
+   */
+  template <typename T> void cBasic_Table<T>::Fill(T value) {
+    std::size_t count = (std::size_t)this->stride * this->height;
+    if (value == 0) {
+      std::memset(this->data, 0, count * sizeof(T));
+    }
+    else {
+      std::fill_n(this->data, count, value);
+    }
+  }
+
+  /**
+   * Gets a row of the table. The next row starts stride columns later.
+   * @param index The index of the row.
+   * @return The first column of the row.
+   * @throws An error if the row does not exist.
+   */
+  template <typename T> T* cBasic_Table<T>::Get_Row(int index) {
+    if ((index >= 0) && (index < this->height)) {
+      return this->data + ((std::size_t)index * this->stride);
+    }
+    else {
+      throw cError("Invalid row access at " + Number_To_Text(index) + ".");
+    }
+  }
+
+  /**
+   * Allocates a cleared buffer for the rows and points the rows into it. The
+   * old rows are freed.
+   * @param width The width of the table.
+   * @param height The height of the table.
+   */
+  template <typename T> void cBasic_Table<T>::Allocate_Rows(int width, int height) {
+    this->Free_Rows();
+    this->width = width;
+    this->height = height;
+    this->stride = Get_Aligned_Stride(width, sizeof(T));
+    this->data = (T*)Allocate_Buffer((std::size_t)this->stride * height * sizeof(T));
+    this->rows = new T* [height];
+    for (int row_index = 0; row_index < height; row_index++) {
+      this->rows[row_index] = this->data + ((std::size_t)row_index * this->stride);
+    }
+  }
+
+  /**
+   * Frees the rows of the table. A mapped table only owns the row pointers and
+   * the mapping is released instead of the buffer.
+   */
+  template <typename T> void cBasic_Table<T>::Free_Rows() {
+    if (this->mapping) {
+#ifndef _WIN32
+      munmap(this->mapping, this->mapping_size);
+#endif
+      this->mapping = NULL;
+      this->mapping_size = 0;
+    }
+    else {
+      Free_Buffer(this->data);
+    }
+    delete[] this->rows;
+    this->rows = NULL;
+    this->data = NULL;
+    this->stride = 0;
+  }
+
+  // **************************************************************************
+  // Blitter Implementation
+  // **************************************************************************
+
+  /**
+   * Blends a row of picture cells onto the screen. Cells that are zero are
+   * transparent and leave the screen alone. The row is done with the widest
+   * vector instructions the machine has and finished off one cell at a time.
+   * @param target The first screen cell.
+   * @param source The picture cell that lands on the first screen cell.
+   * @param count The number of cells.
+   * @param reverse True if the source is read backwards to flip the row.
+   */
+  template <typename T> void Blend_Row(T* target, const T* source, int count, bool reverse) {
+    int index = 0;
+#if NERD_SIMD
+    int level = Get_SIMD_Level();
+    if (level == eSIMD_AVX2) {
+      index = Blend_Row_AVX2(target, source, count, reverse);
+    }
+    if (level >= eSIMD_SSE2) {
+      index += Blend_Row_SSE2(target + index, reverse ? (source - index) : (source + index), count - index, reverse);
+    }
+#endif
+    int step = reverse ? -1 : 1;
+    const T* pixel = source + (index * step);
+    for (; index < count; index++) {
+      if (*pixel) {
+        target[index] = *pixel;
+      }
+      pixel += step;
+    }
+  }
+
+  /**
+   * Converts a row of cells into 32-bit pixels through a lookup table. With
+   * AVX2 eight cells are widened and looked up with one gather.
+   * @param target Where the pixels go.
+   * @param source The first cell.
+   * @param count The number of cells.
+   * @param lut The table of pixels for each cell value.
+   */
+  template <typename T> void Convert_Row(unsigned int* target, const T* source, int count, const unsigned int* lut) {
+    int index = 0;
+#if NERD_SIMD
+    if (Get_SIMD_Level() == eSIMD_AVX2) {
+      index = Convert_Row_AVX2(target, source, count, lut);
+    }
+#endif
+    for (; index < count; index++) {
+      target[index] = lut[source[index]];
+    }
+  }
+
+#if NERD_SIMD
+  /**
+   * Converts whole blocks of eight cells with an AVX2 gather. Only called when
+   * the machine supports AVX2.
+   * @param target Where the pixels go.
+   * @param source The first cell.
+   * @param count The number of cells.
+   * @param lut The table of pixels for each cell value.
+   * @return The number of cells converted.
+   */
+  template <typename T> NERD_TARGET_AVX2 int Convert_Row_AVX2(unsigned int* target, const T* source, int count, const unsigned int* lut) {
+    int index = 0;
+    for (; (index + 8) <= count; index += 8) {
+      __m256i cells;
+      if constexpr (sizeof(T) == 1) {
+        cells = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(source + index)));
+      }
+      else if constexpr (sizeof(T) == 2) {
+        cells = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)(source + index)));
+      }
+      else {
+        cells = _mm256_loadu_si256((const __m256i*)(source + index));
+      }
+      __m256i pixels = _mm256_i32gather_epi32((const int*)lut, cells, 4);
+      _mm256_storeu_si256((__m256i*)(target + index), pixels);
+    }
+    return index;
+  }
+
+  /**
+   * Blends whole 16-byte blocks of a row with SSE2. Zero cells are turned
+   * into a mask that keeps the screen. A reversed row is loaded from the end
+   * and its cells are shuffled back to front.
+   * @param target The first screen cell.
+   * @param source The picture cell that lands on the first screen cell.
+   * @param count The number of cells.
+   * @param reverse True if the source is read backwards.
+   * @return The number of cells blended.
+   */
+  template <typename T> int Blend_Row_SSE2(T* target, const T* source, int count, bool reverse) {
+    const int lanes = 16 / sizeof(T);
+    __m128i zero = _mm_setzero_si128();
+    int index = 0;
+    for (; (index + lanes) <= count; index += lanes) {
+      __m128i pixels;
+      if (reverse) {
+        pixels = _mm_loadu_si128((const __m128i*)(source - index - lanes + 1));
+        if constexpr (sizeof(T) == 1) {
+          pixels = _mm_or_si128(_mm_slli_epi16(pixels, 8), _mm_srli_epi16(pixels, 8));
+        }
+        if constexpr (sizeof(T) <= 2) {
+          pixels = _mm_shufflelo_epi16(pixels, _MM_SHUFFLE(0, 1, 2, 3));
+          pixels = _mm_shufflehi_epi16(pixels, _MM_SHUFFLE(0, 1, 2, 3));
+          pixels = _mm_shuffle_epi32(pixels, _MM_SHUFFLE(1, 0, 3, 2));
+        }
+        else {
+          pixels = _mm_shuffle_epi32(pixels, _MM_SHUFFLE(0, 1, 2, 3));
+        }
+      }
+      else {
+        pixels = _mm_loadu_si128((const __m128i*)(source + index));
+      }
+      __m128i clear;
+      if constexpr (sizeof(T) == 1) {
+        clear = _mm_cmpeq_epi8(pixels, zero);
+      }
+      else if constexpr (sizeof(T) == 2) {
+        clear = _mm_cmpeq_epi16(pixels, zero);
+      }
+      else {
+        clear = _mm_cmpeq_epi32(pixels, zero);
+      }
+      __m128i screen = _mm_loadu_si128((const __m128i*)(target + index));
+      screen = _mm_or_si128(_mm_and_si128(clear, screen), _mm_andnot_si128(clear, pixels));
+      _mm_storeu_si128((__m128i*)(target + index), screen);
+    }
+    return index;
+  }
+
+  /**
+   * Blends whole 32-byte blocks of a row with AVX2. Only called when the
+   * machine supports AVX2.
+   * @param target The first screen cell.
+   * @param source The picture cell that lands on the first screen cell.
+   * @param count The number of cells.
+   * @param reverse True if the source is read backwards.
+   * @return The number of cells blended.
+   */
+  template <typename T> NERD_TARGET_AVX2 int Blend_Row_AVX2(T* target, const T* source, int count, bool reverse) {
+    const int lanes = 32 / sizeof(T);
+    __m256i zero = _mm256_setzero_si256();
+    int index = 0;
+    for (; (index + lanes) <= count; index += lanes) {
+      __m256i pixels;
+      if (reverse) {
+        pixels = _mm256_loadu_si256((const __m256i*)(source - index - lanes + 1));
+        if constexpr (sizeof(T) == 1) {
+          __m256i order = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+          pixels = _mm256_shuffle_epi8(pixels, order);
+          pixels = _mm256_permute2x128_si256(pixels, pixels, 0x01);
+        }
+        else if constexpr (sizeof(T) == 2) {
+          __m256i order = _mm256_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1, 14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+          pixels = _mm256_shuffle_epi8(pixels, order);
+          pixels = _mm256_permute2x128_si256(pixels, pixels, 0x01);
+        }
+        else {
+          pixels = _mm256_permutevar8x32_epi32(pixels, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+        }
+      }
+      else {
+        pixels = _mm256_loadu_si256((const __m256i*)(source + index));
+      }
+      __m256i clear;
+      if constexpr (sizeof(T) == 1) {
+        clear = _mm256_cmpeq_epi8(pixels, zero);
+      }
+      else if constexpr (sizeof(T) == 2) {
+        clear = _mm256_cmpeq_epi16(pixels, zero);
+      }
+      else {
+        clear = _mm256_cmpeq_epi32(pixels, zero);
+      }
+      __m256i screen = _mm256_loadu_si256((const __m256i*)(target + index));
+      _mm256_storeu_si256((__m256i*)(target + index), _mm256_blendv_epi8(pixels, screen, clear));
+    }
+    return index;
+  }
+#endif
+
+  // **************************************************************************
+  // Compiled Picture Implementation
+  // **************************************************************************
+
+  /**
+   * Creates an empty compiled picture.
+   */
+  template <typename T> cCompiled_Picture<T>::cCompiled_Picture() {
+    this->width = 0;
+    this->height = 0;
   }
 
   /**
-   * Converts the buffer to a string.
-   * @return The text from the buffer.
+   * Creates a compiled picture from a picture table.
+   * @param picture The picture table. The first row holds the meta data.
+   * @throws An error if the picture is smaller than its meta data.
    */
-  std::string cTerminal::Buffer_To_String() {
-    std::string text = "";
-    while (this->input_buffer.Count() > 0) {
-      int letter = this->input_buffer.Peek_Front();
-      text += (char)letter;
-      this->input_buffer.Shift();
-    }
-    return text;
+  template <typename T> cCompiled_Picture<T>::cCompiled_Picture(cBasic_Table<T>& picture) {
+    this->width = 0;
+    this->height = 0;
+    this->Compile(picture);
   }
 
   /**
-   * Sets the error mode.
-   * @param error If true then error mode is set, otherwise it is set to output.
+   * Compiles a picture table into runs of opaque cells. Each row becomes a
+   * list of spans that say where a run starts and where its cells are kept.
+   * Transparent cells are not stored at all. A version is made for every
+   * drawing mode so flipped pictures are drawn the same way.
+   * @param picture The picture table. The first row holds the meta data.
+   * @throws An error if the picture is smaller than its meta data.
    */
-  void cTerminal::Set_Error_Mode(bool error) {
-    if (error) {
-      this->status = eSTATUS_ERROR;
-      this->Set_Color(128, 0, 0);
+  template <typename T> void cCompiled_Picture<T>::Compile(cBasic_Table<T>& picture) {
+    Check_Condition(((picture.width >= 2) && (picture.height >= 1)), "Picture has no meta data.");
+    int width = picture.rows[0][0];
+    int height = picture.rows[0][1];
+    Check_Condition(((width >= 0) && (height >= 0) && (width <= picture.width) && (height < picture.height)), "Picture is smaller than its meta data.");
+    this->Clear();
+    this->width = width;
+    this->height = height;
+    for (int mode = 0; mode < MODE_COUNT; mode++) {
+      bool flip_x = ((mode & eDRAW_FLIPPED_X) != 0);
+      bool flip_y = ((mode & eDRAW_FLIPPED_Y) != 0);
+      cVector<T>& pixels = this->pixels[mode];
+      cVector<sPicture_Span>& spans = this->spans[mode];
+      cVector<int>& row_spans = this->row_spans[mode];
+      row_spans.Reserve(height + 1);
+      for (int row_index = 0; row_index < height; row_index++) {
+        T* source = picture.rows[1 + (flip_y ? (height - 1 - row_index) : row_index)];
+        row_spans.Add(spans.Count());
+        int col_index = 0;
+        while (col_index < width) {
+          // Skip transparent cells.
+          while ((col_index < width) && !source[flip_x ? (width - 1 - col_index) : col_index]) {
+            col_index++;
+          }
+          if (col_index < width) {
+            sPicture_Span span = { col_index, 0, pixels.Count() };
+            while ((col_index < width) && source[flip_x ? (width - 1 - col_index) : col_index]) {
+              pixels.Add(source[flip_x ? (width - 1 - col_index) : col_index]);
+              col_index++;
+            }
+            span.length = col_index - span.start;
+            spans.Add(span);
+          }
+        }
+      }
+      row_spans.Add(spans.Count());
+      pixels.Shrink_To_Fit();
+      spans.Shrink_To_Fit();
     }
-    else {
-      this->status = eSTATUS_OUTPUT;
-      this->Set_Color(0, 0, 0);
+  }
+
+  /**
+   * Loads a picture table from a file and compiles it.
+   * @param name The name of the file.
+   * @throws An error if the picture could not be loaded.
+   */
+  template <typename T> void cCompiled_Picture<T>::Load(std::string name) {
+    cBasic_Table<T> picture(0, 0);
+    picture.Load_From_File(name);
+    this->Compile(picture);
+  }
+
+  /**
+   * Clears out the compiled picture.
+   */
+  template <typename T> void cCompiled_Picture<T>::Clear() {
+    this->width = 0;
+    this->height = 0;
+    for (int mode = 0; mode < MODE_COUNT; mode++) {
+      this->pixels[mode].Clear();
+      this->spans[mode].Clear();
+      this->row_spans[mode].Clear();
     }
   }
 
   // **************************************************************************
-  // Parameters Implementation
+  // Worker Pool Implementation
   // **************************************************************************
 
   /**
-   * Parses the incoming parameters and creates a new parameter object.
-   * @param argc The number of arguments in the command line.
-   * @param argv The argument vector.
-   * @param names The names of the parameters.
-   * @throws An error if there are parameters missing.
+   * Creates a pool of worker threads. The threads sleep until there is work.
+   * @param worker_count The number of worker threads. Zero runs everything on
+   *   the calling thread.
+   */
+  cWorker_Pool::cWorker_Pool(int worker_count) {
+    this->worker_count = worker_count;
+    this->task_count = 0;
+    this->next_task = 0;
+    this->busy_count = 0;
+    this->generation = 0;
+    this->stopping = false;
+    this->failed = false;
+    this->threads = NULL;
+    if (worker_count > 0) {
+      this->threads = new std::thread[worker_count];
+      for (int worker_index = 0; worker_index < worker_count; worker_index++) {
+        this->threads[worker_index] = std::thread(&cWorker_Pool::Worker_Loop, this);
+      }
+    }
+  }
+
+  /**
+   * Stops the worker threads and waits for them to finish.
    */
-  cParameters::cParameters(int argc, char** argv, cArray<std::string> names) {
-    int param_count = names.Count();
-    Check_Condition((argc == (param_count + 1)), "Missing parameters! Arguments are: " + Join(names, " ")); // Accounts for program name.
-    for (int arg_index = 1; arg_index < argc; arg_index++) { // Don't want first parameter.
-      std::string name = names[arg_index - 1];
-      std::string param = argv[arg_index];
-      cValue value;
+  cWorker_Pool::~cWorker_Pool() {
+    {
+      std::lock_guard<std::mutex> guard(this->lock);
+      this->stopping = true;
+    }
+    this->wake.notify_all();
+    for (int worker_index = 0; worker_index < this->worker_count; worker_index++) {
+      this->threads[worker_index].join();
+    }
+    if (this->threads) {
+      delete[] this->threads;
+    }
+  }
+
+  /**
+   * Runs a number of tasks on the pool and waits for all of them. The calling
+   * thread takes tasks too. Tasks are handed out in order but may finish in
+   * any order. If the pool is already busy with another caller the tasks run
+   * on the calling thread alone.
+   * @param task_count The number of tasks.
+   * @param task The task to run. It gets the index of the task.
+   * @throws An error if a task threw an error.
+   */
+  void cWorker_Pool::Run(int task_count, std::function<void(int)> task) {
+    std::unique_lock<std::mutex> run_guard(this->run_lock, std::try_to_lock);
+    if ((this->worker_count == 0) || (task_count < 2) || !run_guard.owns_lock()) {
+      for (int task_index = 0; task_index < task_count; task_index++) {
+        task(task_index);
+      }
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> guard(this->lock);
+      this->task = task;
+      this->task_count = task_count;
+      this->next_task = 0;
+      this->busy_count = this->worker_count;
+      this->failed = false;
+      this->generation++;
+    }
+    this->wake.notify_all();
+    this->Work();
+    std::unique_lock<std::mutex> guard(this->lock);
+    this->done.wait(guard, [this]() { return (this->busy_count == 0); });
+    this->task = nullptr;
+    if (this->failed) {
+      throw cError(this->error);
+    }
+  }
+
+  /**
+   * Gets the number of threads that run tasks, counting the calling thread.
+   * @return The number of threads.
+   */
+  int cWorker_Pool::Get_Thread_Count() {
+    return this->worker_count + 1;
+  }
+
+  /**
+   * Waits for work and runs it until the pool is stopped.
+   */
+  void cWorker_Pool::Worker_Loop() {
+    int seen_generation = 0;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> guard(this->lock);
+        this->wake.wait(guard, [this, seen_generation]() { return (this->stopping || (this->generation != seen_generation)); });
+        if (this->stopping) {
+          break;
+        }
+        seen_generation = this->generation;
+      }
+      this->Work();
+      std::lock_guard<std::mutex> guard(this->lock);
+      this->busy_count--;
+      if (this->busy_count == 0) {
+        this->done.notify_one();
+      }
+    }
+  }
+
+  /**
+   * Takes tasks until there are none left. Nothing a task throws gets out,
+   * so the pool always finishes the run. The first error is kept for the
+   * caller of Run.
+   */
+  void cWorker_Pool::Work() {
+    int task_index = this->next_task++;
+    while (task_index < this->task_count) {
       try {
-        value.Set_Number(Text_To_Number(param));
+        this->task(task_index);
       }
-      catch (cError number_error) {
-        value.Set_String(param);
+      catch (cError error) {
+        this->Record_Error(error.message);
+      }
+      catch (std::exception& error) {
+        this->Record_Error(error.what());
+      }
+      catch (...) {
+        this->Record_Error("A worker task failed.");
       }
-      this->params[name] = value;
+      task_index = this->next_task++;
     }
   }
 
   /**
-   * Gets the parameter value given the name.
-   * @param name The name of the parameter to retrieve.
-   * @return The value at the parameter.
-   * @throws An error if the parameter does not exist.
+   * Keeps an error from a task unless one was already kept this run.
+   * @param message The error message.
    */
-  cValue& cParameters::operator[] (std::string name) {
-    Check_Condition(this->params.Does_Key_Exist(name), "Parameter " + name + " does not exist.");
-    return this->params[name];
+  void cWorker_Pool::Record_Error(std::string message) {
+    std::lock_guard<std::mutex> guard(this->lock);
+    if (!this->failed) {
+      this->failed = true;
+      this->error = message;
+    }
   }
 
   // **************************************************************************
-  // Table Implementation
+  // Picture Processor Implementation
   // **************************************************************************
 
   /**
-   * Creates a new table of the specified width and height.
-   * @param width The width of the table.
-   * @param height The height of the table.
+   * Creates a new picture processor with screen of the specified dimensions.
+   * @param width The width of the screen.
+   * @param height The height of the screen.
    */
-  cTable::cTable(int width, int height) {
+  template <typename T> cBasic_Picture_Processor<T>::cBasic_Picture_Processor(int width, int height) {
     this->width = width;
     this->height = height;
-    this->row_pointer = 0;
-    this->col_pointer = 0;
-    this->rows = new int* [height];
-    for (int row_index = 0; row_index < height; row_index++) {
-      this->rows[row_index] = new int[width];
-      for (int col_index = 0; col_index < width; col_index++) {
-        this->rows[row_index][col_index] = 0;
+    this->palette_size = 0;
+    this->palette = NULL;
+    this->palette_lut = NULL;
+    this->palette_lut_size = 0;
+    this->stride = Get_Aligned_Stride(width, sizeof(T));
+    this->pixels = (T*)Allocate_Buffer((std::size_t)this->stride * height * sizeof(T));
+    this->screen = new T* [height];
+    for (int y = 0; y < height; y++) {
+      this->screen[y] = this->pixels + ((std::size_t)y * this->stride);
+    }
+    this->pixels_uploaded = 0;
+    this->recording = false;
+    this->command_frame = 0;
+    this->Mark_All_Dirty(); // Nothing has been shown yet.
+  }
+
+  /**
+   * Frees the picture processor.
+   */
+  template <typename T> cBasic_Picture_Processor<T>::~cBasic_Picture_Processor() {
+    // Free the screen.
+    delete[] this->screen;
+    Free_Buffer(this->pixels);
+    // Free the palette.
+    if (this->palette) {
+      delete[] this->palette;
+    }
+    if (this->palette_lut) {
+      delete[] this->palette_lut;
+    }
+  }
+
+  /**
+   * Loads the palette from a file.
+   * @param name The name of the palette to load. No extension.
+   * @throws An error if the palette could not be loaded.
+   */
+  template <typename T> void cBasic_Picture_Processor<T>::Load_Palette(std::string name) {
+    cFile pal_file(name + ".txt");
+    pal_file.Read();
+    cArray<sColor> pal_entries;
+    while (pal_file.Has_More_Lines()) {
+      std::string line = pal_file.Get_Line();
+      std::string_view tripplet[3];
+      if (cTokenizer(line, ' ').Split(tripplet, 3) == 3) {
+        sColor color = { 0, 0, 0 };
+        color.red = Text_To_Number(tripplet[0]);
+        color.green = Text_To_Number(tripplet[1]);
+        color.blue = Text_To_Number(tripplet[2]);
+        pal_entries.Add(color);
+      }
+      else {
+        throw cError("Invalid palette entry " + line + ".");
+      }
+    }
+    // Allocate and load the palette.
+    if (pal_entries.Count() > 0) {
+      int last_index = pal_entries.Count() - 1;
+      Check_Condition((last_index == (T)last_index), "Palette " + name + " has too many colors for the screen.");
+      if (this->palette) {
+        delete[] this->palette;
+      }
+      this->palette_size = pal_entries.Count();
+      this->palette = new sColor[this->palette_size];
+      for (int entry_index = 0; entry_index < this->palette_size; entry_index++) {
+        sColor& color = this->palette[entry_index];
+        sColor& pal_entry = pal_entries[entry_index];
+        color = pal_entry;
+      }
+      this->Build_Palette_LUT();
+      this->Mark_All_Dirty(); // Every color may have changed.
+    }
+    else {
+      throw cError("Empty palette!");
+    }
+  }
+
+  /**
+   * Draws a picture to the screen. Zero cells are transparent. The picture
+   * is clipped to the screen and each visible row is blended in one go. When
+   * commands are being recorded the picture is only recorded and must stay
+   * as it is until the commands are rendered.
+   * @param picture The picture grid.
+   * @param x The x coordinate.
+   * @param y The y coordinate.
+   * @param mode The drawing mode. Flipping on x mirrors the columns and
+   *   flipping on y mirrors the rows. Both may be set.
+   * @throws An error if the wrong mode was set or the picture is smaller than
+   *   its meta data says.
+   */
+  template <typename T> void cBasic_Picture_Processor<T>::Draw_Picture(cBasic_Table<T>& picture, int x, int y, int mode) {
+    Check_Condition(((mode & ~(eDRAW_FLIPPED_X | eDRAW_FLIPPED_Y)) == 0), "Wrong drawing mode set for picture.");
+    // The first row stores the meta data.
+    int width = picture.Read_Column();
+    int height = picture.Read_Column();
+    picture.Move_To_Next_Row(); // Move to where pixel data is.
+    Check_Condition(((width <= picture.width) && (height <= (picture.height - picture.row_pointer))), "Picture is smaller than its meta data.");
+    // Clip the picture to the screen.
+    int left = (x < 0) ? 0 : x;
+    int right = ((x + width) > this->width) ? this->width : (x + width);
+    int top = (y < 0) ? 0 : y;
+    int bottom = ((y + height) > this->height) ? this->height : (y + height);
+    if ((left < right) && (top < bottom)) {
+      this->Mark_Dirty(left, top, right - left, bottom - top);
+      sDraw_Command<T> command = { eCOMMAND_PICTURE, x, y, mode, width, height, picture.rows + picture.row_pointer, NULL, 0 };
+      if (this->recording) {
+        this->commands.Add(command);
+      }
+      else {
+        this->Blit_Picture(command, 0, this->height);
+      }
+    }
+  }
+
+  /**
+   * Draws a compiled picture to the screen. Only the opaque runs are visited
+   * and each one is copied straight onto the screen after clipping. When
+   * commands are being recorded the picture is only recorded.
+   * @param picture The compiled picture.
+   * @param x The x coordinate.
+   * @param y The y coordinate.
+   * @param mode The drawing mode, the same as for a picture table.
+   * @throws An error if the wrong mode was set.
+   */
+  template <typename T> void cBasic_Picture_Processor<T>::Draw_Picture(cCompiled_Picture<T>& picture, int x, int y, int mode) {
+    Check_Condition(((mode & ~(eDRAW_FLIPPED_X | eDRAW_FLIPPED_Y)) == 0), "Wrong drawing mode set for picture.");
+    int top = (y < 0) ? 0 : y;
+    int bottom = ((y + picture.height) > this->height) ? this->height : (y + picture.height);
+    if ((x < this->width) && ((x + picture.width) > 0) && (top < bottom)) {
+      this->Mark_Dirty(x, top, picture.width, bottom - top);
+      sDraw_Command<T> command = { eCOMMAND_COMPILED_PICTURE, x, y, mode, picture.width, picture.height, NULL, &picture, 0 };
+      if (this->recording) {
+        this->commands.Add(command);
+      }
+      else {
+        this->Blit_Compiled_Picture(command, 0, this->height);
+      }
+    }
+  }
+
+  /**
+   * Clears the screen to a specified color.
+   * @param color The color of the screen.
+   * @throws An error if the color is not on the palette.
+   */
+  template <typename T> void cBasic_Picture_Processor<T>::Clear_Screen(sColor color) {
+    this->Fill_Screen(this->Scan_Palette(color));
+  }
+
+  /**
+   * Fills the whole screen with a color index in one sweep of the buffer.
+   * Recorded commands before the fill are dropped since it covers them.
+   * @param color_index The index of the color on the palette.
+   */
+  template <typename T> void cBasic_Picture_Processor<T>::Fill_Screen(T color_index) {
+    this->Mark_All_Dirty();
+    if (this->recording) {
+      sDraw_Command<T> command = { eCOMMAND_FILL, 0, 0, eDRAW_NORMAL, this->width, this->height, NULL, NULL, color_index };
+      this->commands.Clear();
+      this->commands.Add(command);
+    }
+    else {
+      this->Fill_Rows(color_index, 0, this->height);
+    }
+  }
+
+  /**
+   * Scans the palette looking for a color.
+   * @param color The color to look for.
+   * @return The color index.
+   * @throws An error if the color was not found.
+   */
+  template <typename T> int cBasic_Picture_Processor<T>::Scan_Palette(sColor color) {
+    int color_index = -1;
+    for (int entry_index = 0; entry_index < this->palette_size; entry_index++) {
+      sColor entry = this->palette[entry_index];
+      if ((color.red == entry.red) && (color.green == entry.green) && (color.blue == entry.blue)) {
+        color_index = entry_index;
+        break;
+      }
+    }
+    if (color_index == -1) { // No color found.
+      throw cError("Color not found in palette.");
+    }
+    return color_index;
+  }
+
+  /**
+   * Dumps the picture processor.
+   */
+  template <typename T> void cBasic_Picture_Processor<T>::Dump() {
+    // Dump the palette.
+    std::cout << "*** palette ***" << std::endl;
+    for (int entry_index = 0; entry_index < this->palette_size; entry_index++) {
+      sColor entry = this->palette[entry_index];
+      std::cout << entry.red << "," << entry.green << "," << entry.blue << std::endl;
+    }
+    std::cout << "*** screen ***" << std::endl;
+    for (int row_index = 0; row_index < this->height; row_index++) {
+      for (int col_index = 0; col_index < this->width; col_index++) {
+        std::cout << (int)this->screen[row_index][col_index];
+        if (col_index < (this->width - 1)) {
+          std::cout << " ";
+        }
+      }
+      std::cout << std::endl;
+    }
+  }
+
+  /**
+   * Marks part of the screen as changed so the next display update sends it.
+   * The area is merged with a dirty rectangle when their bounding box is no
+   * bigger than the two apart. When the list is full the two rectangles whose
+   * bounding box adds the fewest pixels are merged. Once half the screen is
+   * dirty the whole screen is marked.
+   * @param x The x coordinate of the area.
+   * @param y The y coordinate of the area.
+   * @param width The width of the area.
+   * @param height The height of the area.
+   */
+  template <typename T> void cBasic_Picture_Processor<T>::Mark_Dirty(int x, int y, int width, int height) {
+    sRectangle area = { (x < 0) ? 0 : x, (y < 0) ? 0 : y, x + width - 1, y + height - 1 };
+    area.right = (area.right >= this->width) ? (this->width - 1) : area.right;
+    area.bottom = (area.bottom >= this->height) ? (this->height - 1) : area.bottom;
+    if ((area.left > area.right) || (area.top > area.bottom)) {
+      return;
+    }
+    int rect_index = 0;
+    while (rect_index < this->dirty_rects.Count()) {
+      sRectangle& rect = this->dirty_rects[rect_index];
+      sRectangle merged = Merge_Rectangles(area, rect);
+      if (Get_Rectangle_Area(merged) <= (Get_Rectangle_Area(area) + Get_Rectangle_Area(rect))) {
+        // Take in the rectangle and check the others again.
+        area = merged;
+        this->dirty_rects.Remove(rect_index);
+        rect_index = 0;
+      }
+      else {
+        rect_index++;
+      }
+    }
+    this->dirty_rects.Add(area);
+    // Past half the screen one big upload is cheaper than many small ones.
+    long long dirty_area = 0;
+    for (rect_index = 0; rect_index < this->dirty_rects.Count(); rect_index++) {
+      dirty_area += Get_Rectangle_Area(this->dirty_rects[rect_index]);
+    }
+    if ((dirty_area * 2) >= ((long long)this->width * this->height)) {
+      this->Mark_All_Dirty();
+    }
+    else if (this->dirty_rects.Count() > MAX_DIRTY_RECTS) {
+      int count = this->dirty_rects.Count();
+      int best_first = 0;
+      int best_second = 1;
+      long long best_growth = LLONG_MAX;
+      for (int first = 0; first < count; first++) {
+        sRectangle& first_rect = this->dirty_rects[first];
+        for (int second = first + 1; second < count; second++) {
+          sRectangle& second_rect = this->dirty_rects[second];
+          long long growth = Get_Rectangle_Area(Merge_Rectangles(first_rect, second_rect)) - Get_Rectangle_Area(first_rect) - Get_Rectangle_Area(second_rect);
+          if (growth < best_growth) {
+            best_growth = growth;
+            best_first = first;
+            best_second = second;
+          }
+        }
       }
+      this->dirty_rects[best_first] = Merge_Rectangles(this->dirty_rects[best_first], this->dirty_rects[best_second]);
+      this->dirty_rects.Remove(best_second);
     }
   }
 
   /**
-   * Frees up the table.
+   * Marks the whole screen as changed.
    */
-  cTable::~cTable() {
-    for (int row_index = 0; row_index < this->height; row_index++) {
-      delete[] this->rows[row_index];
+  template <typename T> void cBasic_Picture_Processor<T>::Mark_All_Dirty() {
+    this->dirty_rects.Clear();
+    if ((this->width > 0) && (this->height > 0)) {
+      sRectangle area = { 0, 0, this->width - 1, this->height - 1 };
+      this->dirty_rects.Add(area);
     }
-    delete[] this->rows;
   }
 
   /**
-   * Moves to the next row.
-   * @throws An error if are no more rows to move to.
+   * Forgets the changed areas once they have been sent to the display.
    */
-  void cTable::Move_To_Next_Row() {
-    if (this->row_pointer < this->height) {
-      this->row_pointer++;
-      this->col_pointer = 0; // Reset column pointer.
-    }
-    else {
-      throw cError("No more rows to move to!");
-    }
+  template <typename T> void cBasic_Picture_Processor<T>::Clear_Dirty() {
+    this->dirty_rects.Clear();
   }
 
   /**
-   * Reads a single column from the table.
-   * @return The numeric value of the column.
-   * @throws An error if there are no more columns to read.
+   * Packs the palette into 32-bit ARGB words so a cell turns into a display
+   * pixel with a single lookup. For 8-bit cells the table covers every index
+   * and unused ones are black. Call this again after changing the palette.
    */
-  int cTable::Read_Column() {
-    int value = 0;
-    if (this->col_pointer < this->width) {
-      value = this->rows[this->row_pointer][this->col_pointer];
-      this->col_pointer++;
+  template <typename T> void cBasic_Picture_Processor<T>::Build_Palette_LUT() {
+    int lut_size = (sizeof(T) == 1) ? 256 : this->palette_size;
+    if (lut_size != this->palette_lut_size) {
+      if (this->palette_lut) {
+        delete[] this->palette_lut;
+      }
+      this->palette_lut = new unsigned int[lut_size];
+      this->palette_lut_size = lut_size;
     }
-    else {
-      throw cError("No more columns to read!");
+    for (int entry_index = 0; entry_index < lut_size; entry_index++) {
+      unsigned int pixel = 0xFF000000;
+      if (entry_index < this->palette_size) {
+        sColor& color = this->palette[entry_index];
+        pixel |= ((color.red & 0xFF) << 16) | ((color.green & 0xFF) << 8) | (color.blue & 0xFF);
+      }
+      this->palette_lut[entry_index] = pixel;
     }
-    return value;
   }
 
   /**
-   * Moves to a specified column.
-   * @param index The index of the column to move to.
-   * @throws An error if the index is out of bounds.
+   * Converts part of a screen row into 32-bit ARGB pixels.
+   * @param target Where the pixels go.
+   * @param x The x coordinate of the first cell.
+   * @param y The row of the screen.
+   * @param count The number of cells.
    */
-  void cTable::Move_To_Column(int index) {
-    if ((index >= 0) && (index < this->width)) {
-      this->col_pointer = index;
-    }
-    else {
-      throw cError("Column is out of bounds.");
+  template <typename T> void cBasic_Picture_Processor<T>::Convert_Row(unsigned int* target, int x, int y, int count) {
+    if (!this->palette_lut) {
+      this->Build_Palette_LUT();
     }
+    Nerd::Convert_Row(target, this->screen[y] + x, count, this->palette_lut);
   }
 
   /**
-   * Writes a value to a column.
-   * @param value The value to write to the column.
-   * @throws An error if there are no more columns to write to.
+   * Starts recording draw commands for a frame. Drawing only records until
+   * the commands are rendered, so the screen is not touched in between.
    */
-  void cTable::Write_Column(int value) {
-    if (this->col_pointer < this->width) {
-      this->rows[this->row_pointer][this->col_pointer] = value;
-      this->col_pointer++;
-    }
-    else {
-      throw cError("No more columns to write to!");
-    }
+  template <typename T> void cBasic_Picture_Processor<T>::Begin_Commands() {
+    this->commands.Clear();
+    this->recording = true;
+    this->command_frame++;
   }
 
   /**
-   * Rewinds the pointers to read and write from the beginning of the table.
+   * Renders the recorded commands on the shared worker pool and stops
+   * recording.
+   * @throws An error if a command could not be rendered.
    */
-  void cTable::Rewind() {
-    this->row_pointer = 0;
-    this->col_pointer = 0;
+  template <typename T> void cBasic_Picture_Processor<T>::Render_Commands() {
+    this->Render_Commands(Get_Worker_Pool());
   }
 
   /**
-   * Allows a table to be assigned to another table.
-   * @param other The other table to assign from.
-   * @return The reference to this table.
+   * Renders the recorded commands and stops recording. The screen is split
+   * into bands of rows and each band replays every command in order, clipped
+   * to itself, so the result is the same as drawing straight to the screen.
+   * Bands are handed out to the threads of the pool as they get free.
+   * @param pool The worker pool to render on.
+   * @throws An error if a command could not be rendered.
    */
-  cTable& cTable::operator=(cTable& other) {
-    // Delete our rows.
-    for (int row_index = 0; row_index < this->height; row_index++) {
-      delete[] this->rows[row_index];
+  template <typename T> void cBasic_Picture_Processor<T>::Render_Commands(cWorker_Pool& pool) {
+    this->recording = false;
+    if (this->commands.Count() > 0) {
+      int band_count = pool.Get_Thread_Count() * BANDS_PER_THREAD;
+      int band_height = (this->height + band_count - 1) / band_count;
+      band_height = (band_height < MIN_BAND_HEIGHT) ? MIN_BAND_HEIGHT : band_height;
+      band_count = (this->height + band_height - 1) / band_height;
+      pool.Run(band_count, [this, band_height](int band_index) {
+        int band_top = band_index * band_height;
+        int band_bottom = ((band_top + band_height) > this->height) ? this->height : (band_top + band_height);
+        for (int command_index = 0; command_index < this->commands.Count(); command_index++) {
+          this->Run_Command(this->commands.At_Unchecked(command_index), band_top, band_bottom);
+        }
+      });
+      this->commands.Clear();
     }
-    delete[] this->rows;
-    // Allocate new rows.
-    this->width = other.width;
-    this->height = other.height;
-    this->row_pointer = 0;
-    this->col_pointer = 0;
-    this->rows = new int* [this->height];
-    for (int row_index = 0; row_index < this->height; row_index++) {
-      this->rows[row_index] = new int[this->width];
-      for (int col_index = 0; col_index < this->width; col_index++) {
-        this->rows[row_index][col_index] = other.rows[row_index][col_index];
+  }
+
+  /**
+   * Runs a draw command on a band of screen rows.
+   * @param command The draw command.
+   * @param band_top The first row of the band.
+   * @param band_bottom The row after the last row of the band.
+   */
+  template <typename T> void cBasic_Picture_Processor<T>::Run_Command(sDraw_Command<T>& command, int band_top, int band_bottom) {
+    switch (command.type) {
+      case eCOMMAND_PICTURE: {
+        this->Blit_Picture(command, band_top, band_bottom);
+        break;
+      }
+      case eCOMMAND_COMPILED_PICTURE: {
+        this->Blit_Compiled_Picture(command, band_top, band_bottom);
+        break;
+      }
+      case eCOMMAND_FILL: {
+        this->Fill_Rows(command.color_index, band_top, band_bottom);
+        break;
       }
     }
-    return (*this);
   }
 
   /**
-   * Clears out the table's rows.
-   */
-  void cTable::Clear() {
-    for (int row_index = 0; row_index < this->height; row_index++) {
-      for (int col_index = 0; col_index < this->width; col_index++) {
-        this->rows[row_index][col_index] = 0;
+   * Blends the rows of a picture table that fall inside a band.
+   * @param command The draw command holding the picture rows.
+   * @param band_top The first row of the band.
+   * @param band_bottom The row after the last row of the band.
+   */
+  template <typename T> void cBasic_Picture_Processor<T>::Blit_Picture(sDraw_Command<T>& command, int band_top, int band_bottom) {
+    int x = command.x;
+    int y = command.y;
+    int left = (x < 0) ? 0 : x;
+    int right = ((x + command.width) > this->width) ? this->width : (x + command.width);
+    int top = (y < band_top) ? band_top : y;
+    int bottom = ((y + command.height) > band_bottom) ? band_bottom : (y + command.height);
+    if ((left < right) && (top < bottom)) {
+      bool flip_x = ((command.mode & eDRAW_FLIPPED_X) != 0);
+      bool flip_y = ((command.mode & eDRAW_FLIPPED_Y) != 0);
+      int count = right - left;
+      int src_col = flip_x ? (command.width - 1 - (left - x)) : (left - x);
+      T* target = this->screen[top] + left;
+      for (int screen_row = top; screen_row < bottom; screen_row++) {
+        int src_row = flip_y ? (command.height - 1 - (screen_row - y)) : (screen_row - y);
+        Blend_Row(target, command.rows[src_row] + src_col, count, flip_x);
+        target += this->stride;
       }
     }
   }
 
   /**
-   * Moves to a specific row.
-   * @param index The index of the row to move to.
-   * @throws An error if the row does not exist.
+   * Copies the runs of a compiled picture that fall inside a band.
+   * @param command The draw command holding the compiled picture.
+   * @param band_top The first row of the band.
+   * @param band_bottom The row after the last row of the band.
+   */
+  template <typename T> void cBasic_Picture_Processor<T>::Blit_Compiled_Picture(sDraw_Command<T>& command, int band_top, int band_bottom) {
+    cCompiled_Picture<T>& picture = *command.picture;
+    int x = command.x;
+    int y = command.y;
+    int top = (y < band_top) ? band_top : y;
+    int bottom = ((y + picture.height) > band_bottom) ? band_bottom : (y + picture.height);
+    if (top < bottom) {
+      T* pixels = picture.pixels[command.mode].Data();
+      sPicture_Span* spans = picture.spans[command.mode].Data();
+      int* row_spans = picture.row_spans[command.mode].Data();
+      bool clipped = (x < 0) || ((x + picture.width) > this->width);
+      for (int screen_row = top; screen_row < bottom; screen_row++) {
+        T* target = this->screen[screen_row];
+        int row_index = screen_row - y;
+        int last_span = row_spans[row_index + 1];
+        for (int span_index = row_spans[row_index]; span_index < last_span; span_index++) {
+          sPicture_Span& span = spans[span_index];
+          int left = x + span.start;
+          int right = left + span.length;
+          int skip = 0;
+          if (clipped) {
+            skip = (left < 0) ? -left : 0;
+            right = (right > this->width) ? this->width : right;
+            left += skip;
+          }
+          int count = right - left;
+          T* source = pixels + span.offset + skip;
+          if (count > cCompiled_Picture<T>::SHORT_SPAN) {
+            std::memcpy(target + left, source, count * sizeof(T));
+          }
+          else {
+            for (int cell_index = 0; cell_index < count; cell_index++) { // A call costs more than a short copy.
+              target[left + cell_index] = source[cell_index];
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Fills a band of screen rows with a color index. The rows of a band sit
+   * next to each other in the buffer so they are filled in one sweep.
+   * @param color_index The index of the color on the palette.
+   * @param band_top The first row of the band.
+   * @param band_bottom The row after the last row of the band.
    */
-  void cTable::Move_To_Row(int index) {
-    if ((index >= 0) && (index < this->height)) {
-      this->row_pointer = index;
-      this->col_pointer = 0;
+  template <typename T> void cBasic_Picture_Processor<T>::Fill_Rows(T color_index, int band_top, int band_bottom) {
+    if (band_top < band_bottom) {
+      std::size_t count = (std::size_t)this->stride * (band_bottom - band_top);
+      if (color_index == 0) {
+        std::memset(this->screen[band_top], 0, count * sizeof(T));
+      }
+      else {
+        std::fill_n(this->screen[band_top], count, color_index);
+      }
     }
-    else {
-      throw cError("Invalid row access at " + Number_To_Text(index) + ".");
+  }
+
+  // **************************************************************************
+  // Tile Map Implementation
+  // **************************************************************************
+
+  /**
+   * Creates a tile map over a table of tile indexes. Tile zero is empty and
+   * the other indexes count the tiles in the order they were added. The
+   * table is not copied and must live as long as the tile map.
+   * @param map The table of tile indexes.
+   */
+  template <typename T> cTile_Map<T>::cTile_Map(cTable& map) {
+    this->map = &map;
+    this->tile_width = 0;
+    this->tile_height = 0;
+    this->scroll_x = 0;
+    this->scroll_y = 0;
+    this->use_chunks = false;
+    this->frame = 0;
+    this->recorded_pp = NULL;
+    this->recorded_frame = 0;
+    for (int chunk_index = 0; chunk_index < MAX_CHUNKS; chunk_index++) {
+      sTile_Chunk<T>& chunk = this->chunks[chunk_index];
+      chunk.chunk_x = -1;
+      chunk.chunk_y = -1;
+      chunk.last_used = -1;
+      chunk.picture = new cBasic_Table<T>(0, 0);
     }
   }
 
   /**
-   * Loads a file into a table.
-   * @param name The name of the file.
-   * @throws An error if the file could not be loaded.
+   * Frees the tiles and the chunk cache.
    */
-  void cTable::Load_From_File(std::string name) {
-    cFile file(name);
-    file.Read();
-    this->Rewind();
-    // Read dimensions.
-    std::string dimensions = file.Get_Line();
-    cArray<std::string> pair = Parse_Sausage_Text(dimensions, "x");
-    if (pair.Count() == 2) {
-      int width = Text_To_Number(pair[0]);
-      int height = Text_To_Number(pair[1]);
-      this->Resize(width, height); // Resize the table to fit the data.
-      // Read the table data.
-      while (file.Has_More_Lines()) {
-        std::string line = file.Get_Line();
-        cArray<std::string> columns = Parse_Sausage_Text(line, " ");
-        int column_count = columns.Count();
-        for (int column_index = 0; column_index < column_count; column_index++) {
-          this->Write_Column(Text_To_Number(columns[column_index]));
-        }
-        this->Move_To_Next_Row();
-      }
-      this->Rewind(); // Rewind after loading.
+  template <typename T> cTile_Map<T>::~cTile_Map() {
+    for (int tile_index = 0; tile_index < this->tiles.Count(); tile_index++) {
+      delete this->tiles[tile_index];
     }
-    else {
-      throw cError("Missing width or height in " + name + ".");
+    for (int chunk_index = 0; chunk_index < MAX_CHUNKS; chunk_index++) {
+      delete this->chunks[chunk_index].picture;
     }
   }
 
   /**
-   * Saves a table to a file.
-   * @param name The name of the file to save to.
+   * Adds a picture to the tile set. The picture is compiled so its meta data
+   * is only read once. Every tile must have the same size as the first one.
+   * @param picture The picture table of the tile.
+   * @return The index of the tile in the map.
+   * @throws An error if the tile size does not match.
    */
-  void cTable::Save_To_File(std::string name) {
-    cFile file(name);
-    this->Rewind();
-    for (int row_index = 0; row_index < this->height; row_index++) {
-      std::string line = "";
-      for (int col_index = 0; col_index < this->width; col_index++) {
-        line += Number_To_Text(this->rows[row_index][col_index]);
-        if (col_index < (this->width - 1)) {
-          line += " ";
-        }
-      }
-      file.Add(line);
+  template <typename T> int cTile_Map<T>::Add_Tile(cBasic_Table<T>& picture) {
+    cCompiled_Picture<T>* tile = new cCompiled_Picture<T>(picture);
+    int width = tile->width;
+    int height = tile->height;
+    if ((width == 0) || (height == 0) || ((this->tiles.Count() > 0) && ((width != this->tile_width) || (height != this->tile_height)))) {
+      delete tile;
+      throw cError("Tile is " + Number_To_Text(width) + "x" + Number_To_Text(height) + " but the tile set is " + Number_To_Text(this->tile_width) + "x" + Number_To_Text(this->tile_height) + ".");
     }
-    file.Write();
+    this->tile_width = width;
+    this->tile_height = height;
+    this->tiles.Add(tile);
+    this->Invalidate_Chunks();
+    return this->tiles.Count();
   }
 
   /**
-   * Resizes the table to a new width and height.
-   * @param width The new width of the table.
-   * @param height The new height of the table.
+   * Sets a tile on the map and drops the chunk holding it from the cache.
+   * @param x The column of the tile.
+   * @param y The row of the tile.
+   * @param tile The index of the tile. Zero is empty.
+   * @throws An error if the tile is off the map or not in the tile set.
    */
-  void cTable::Resize(int width, int height) {
-    // Delete rows.
-    for (int row_index = 0; row_index < this->height; row_index++) {
-      delete[] this->rows[row_index];
+  template <typename T> void cTile_Map<T>::Set_Tile(int x, int y, int tile) {
+    if ((x < 0) || (x >= this->map->width) || (y < 0) || (y >= this->map->height)) {
+      throw cError("Tile " + Number_To_Text(x) + ", " + Number_To_Text(y) + " is off the map.");
     }
-    delete[] this->rows;
-    // Allocate new rows.
-    this->width = width;
-    this->height = height;
-    this->rows = new int* [height];
-    for (int row_index = 0; row_index < height; row_index++) {
-      this->rows[row_index] = new int[width];
-      for (int col_index = 0; col_index < width; col_index++) {
-        this->rows[row_index][col_index] = 0;
+    if ((tile < 0) || (tile > this->tiles.Count())) {
+      throw cError("Tile " + Number_To_Text(tile) + " is not in the tile set.");
+    }
+    this->map->rows[y][x] = tile;
+    int chunk_x = x / CHUNK_SIZE;
+    int chunk_y = y / CHUNK_SIZE;
+    for (int chunk_index = 0; chunk_index < MAX_CHUNKS; chunk_index++) {
+      sTile_Chunk<T>& chunk = this->chunks[chunk_index];
+      if ((chunk.chunk_x == chunk_x) && (chunk.chunk_y == chunk_y)) {
+        chunk.chunk_x = -1;
+        chunk.chunk_y = -1;
       }
     }
-    this->Rewind();
   }
 
   /**
-   * Dumps the contents of a table to the console.
+   * Gets a tile from the map.
+   * @param x The column of the tile.
+   * @param y The row of the tile.
+   * @return The index of the tile. Zero is empty.
+   * @throws An error if the tile is off the map.
    */
-  void cTable::Dump() {
-    std::cout << "table=" << this->width << "x" << this->height << std::endl;
-    std::cout << "row-pointer=" << this->row_pointer << std::endl;
-    std::cout << "col-pointer=" << this->col_pointer << std::endl;
-    std::cout << "*** data ***" << std::endl;
-    for (int row_index = 0; row_index < this->height; row_index++) {
-      for (int col_index = 0; col_index < this->width; col_index++) {
-        std::cout << this->rows[row_index][col_index];
-        if (col_index < (this->width - 1)) {
-          std::cout << " ";
-        }
-      }
-      std::cout << std::endl;
+  template <typename T> int cTile_Map<T>::Get_Tile(int x, int y) {
+    if ((x >= 0) && (x < this->map->width) && (y >= 0) && (y < this->map->height)) {
+      return this->map->rows[y][x];
+    } else {
+      throw cError("Tile " + Number_To_Text(x) + ", " + Number_To_Text(y) + " is off the map.");
     }
   }
 
-  // **************************************************************************
-  // Picture Processor Implementation
-  // **************************************************************************
+  /**
+   * Scrolls the map to a pixel position. The position is the pixel of the
+   * map that shows at the top left corner of the screen.
+   * @param x The x position in pixels.
+   * @param y The y position in pixels.
+   */
+  template <typename T> void cTile_Map<T>::Set_Scroll(int x, int y) {
+    this->scroll_x = x;
+    this->scroll_y = y;
+  }
 
   /**
-   * Creates a new picture processor with screen of the specified dimensions.
-   * @param width The width of the screen.
-   * @param height The height of the screen.
+   * Scrolls the map by a number of pixels.
+   * @param x_amount The pixels to scroll on x.
+   * @param y_amount The pixels to scroll on y.
    */
-  cPicture_Processor::cPicture_Processor(int width, int height) {
-    this->width = width;
-    this->height = height;
-    this->palette_size = 0;
-    this->palette = NULL;
-    this->screen = new int* [height];
-    for (int y = 0; y < height; y++) {
-      this->screen[y] = new int[width];
-      for (int x = 0; x < width; x++) {
-        this->screen[y][x] = 0;
-      }
-    }
+  template <typename T> void cTile_Map<T>::Scroll(int x_amount, int y_amount) {
+    this->scroll_x += x_amount;
+    this->scroll_y += y_amount;
   }
 
   /**
-   * Frees the picture processor.
+   * Turns the chunk cache on or off. With the cache on, blocks of tiles are
+   * drawn once into a chunk picture and the chunk is blended as a whole
+   * until it scrolls out of the cache or one of its tiles changes.
+   * @param use_chunks True to use the chunk cache.
    */
-  cPicture_Processor::~cPicture_Processor() {
-    // Free the screen.
-    for (int y = 0; y < height; y++) {
-      delete[] this->screen[y];
-    }
-    delete[] this->screen;
-    // Free the palette.
-    if (this->palette) {
-      delete[] this->palette;
-    }
+  template <typename T> void cTile_Map<T>::Use_Chunks(bool use_chunks) {
+    this->use_chunks = use_chunks;
   }
 
   /**
-   * Loads the palette from a file.
-   * @param name The name of the palette to load. No extension.
-   * @throws An error if the palette could not be loaded.
+   * Drops every chunk from the cache. Call this after writing to the map
+   * table directly.
    */
-  void cPicture_Processor::Load_Palette(std::string name) {
-    cFile pal_file(name + ".txt");
-    cArray<sColor> pal_entries;
-    while (pal_file.Has_More_Lines()) {
-      std::string line = pal_file.Get_Line();
-      cArray<std::string> tripplet = Parse_Sausage_Text(line, " ");
-      if (tripplet.Count() == 3) {
-        sColor color = { 0, 0, 0 };
-        color.red = Text_To_Number(tripplet[0]);
-        color.green = Text_To_Number(tripplet[1]);
-        color.blue = Text_To_Number(tripplet[2]);
-        pal_entries.Add(color);
-      }
-      else {
-        throw cError("Invalid palette entry " + line + ".");
-      }
-    }
-    // Allocate and load the palette.
-    if (pal_entries.Count() > 0) {
-      this->palette_size = pal_entries.Count();
-      this->palette = new sColor[this->palette_size];
-      for (int entry_index = 0; entry_index < this->palette_size; entry_index++) {
-        sColor& color = this->palette[entry_index];
-        sColor& pal_entry = pal_entries[entry_index];
-        color = pal_entry;
-      }
-    }
-    else {
-      throw cError("Empty palette!");
+  template <typename T> void cTile_Map<T>::Invalidate_Chunks() {
+    for (int chunk_index = 0; chunk_index < MAX_CHUNKS; chunk_index++) {
+      this->chunks[chunk_index].chunk_x = -1;
+      this->chunks[chunk_index].chunk_y = -1;
     }
   }
 
   /**
-   * Draws a picture to the screen.
-   * @param picture The picture grid.
-   * @param x The x coordinate.
-   * @param y The y coordinate.
-   * @param mode The drawing mode.
-   * @throws An error if the wrong mode was set.
+   * Renders the part of the map that shows on the screen. Only visible tiles
+   * are visited and the visible area is marked dirty once for the whole map.
+   * If the picture processor is recording commands the tiles are recorded
+   * too. The map may be rendered many times in one recording, but a map
+   * recorded into two processors at once needs a tile map for each.
+   * @param pp The picture processor to draw on.
+   * @throws An error if the map holds a tile that is not in the tile set.
    */
-  void cPicture_Processor::Draw_Picture(cTable& picture, int x, int y, int mode) {
-    // The first row stores the meta data.
-    int width = picture.Read_Column();
-    int height = picture.Read_Column();
-    picture.Move_To_Next_Row(); // Move to where pixel data is.
-    // Check if image is on the screen.
-    if ((x > -width) && (x < this->width) && (y > -height) && (y < this->height)) {
-      // Clip picture source coordinates.
-      int x_edge = x + width - 1;
-      int y_edge = y + height - 1;
-      int clip_left = (x < 0) ? x * -1 : 0;
-      int clip_right = (x_edge >= this->width) ? (width - (x_edge - this->width - 1) - 1) : width - 1;
-      int clip_top = (y < 0) ? y * -1 : 0;
-      int clip_bottom = (y_edge >= this->height) ? (height - (y_edge - this->height - 1) - 1) : height - 1;
-      if (mode == eDRAW_NORMAL) {
-        for (int row_index = clip_top; row_index <= clip_bottom; row_index++) {
-          for (int col_index = clip_left; col_index <= clip_right; col_index++) {
-            int pixel = picture.rows[picture.row_pointer + row_index][col_index]; // Skip meta data row.
-            if (pixel) {
-              this->screen[y + row_index][x + col_index] = pixel;
-            }
-          }
-        }
+  template <typename T> void cTile_Map<T>::Render(cBasic_Picture_Processor<T>& pp) {
+    if ((this->tiles.Count() > 0) && (this->map->width > 0) && (this->map->height > 0)) {
+      // Chunks that recorded commands point at must not be rebuilt, so a new
+      // frame only starts when the processor is not recording or has begun a
+      // new recording since the last render.
+      if (!pp.recording || (&pp != this->recorded_pp) || (pp.command_frame != this->recorded_frame)) {
+        this->frame++;
       }
-      else {
-        if (((mode & eDRAW_FLIPPED_X) == 0) && ((mode & eDRAW_FLIPPED_Y) != 0)) {
-          for (int row_index = clip_top; row_index <= clip_bottom; row_index++) {
-            int screen_col = x;
-            for (int col_index = clip_right; col_index >= clip_left; col_index--) {
-              int pixel = picture.rows[picture.row_pointer + row_index][col_index]; // Skip meta data row.
-              if (pixel) {
-                this->screen[y + row_index][x + col_index] = pixel;
+      this->recorded_pp = pp.recording ? &pp : NULL;
+      this->recorded_frame = pp.command_frame;
+      int map_width = this->map->width * this->tile_width;
+      int map_height = this->map->height * this->tile_height;
+      pp.Mark_Dirty(-this->scroll_x, -this->scroll_y, map_width, map_height);
+      // Find the visible tiles.
+      int left = std::max(Floor_Divide(this->scroll_x, this->tile_width), 0);
+      int top = std::max(Floor_Divide(this->scroll_y, this->tile_height), 0);
+      int right = std::min(Floor_Divide(this->scroll_x + pp.width - 1, this->tile_width), this->map->width - 1);
+      int bottom = std::min(Floor_Divide(this->scroll_y + pp.height - 1, this->tile_height), this->map->height - 1);
+      if ((left <= right) && (top <= bottom)) {
+        if (this->use_chunks) {
+          for (int chunk_y = top / CHUNK_SIZE; chunk_y <= bottom / CHUNK_SIZE; chunk_y++) {
+            for (int chunk_x = left / CHUNK_SIZE; chunk_x <= right / CHUNK_SIZE; chunk_x++) {
+              sTile_Chunk<T>* chunk = this->Get_Chunk(chunk_x, chunk_y);
+              if (chunk) {
+                cBasic_Table<T>& picture = *chunk->picture;
+                int x = (chunk_x * CHUNK_SIZE * this->tile_width) - this->scroll_x;
+                int y = (chunk_y * CHUNK_SIZE * this->tile_height) - this->scroll_y;
+                sDraw_Command<T> command = { eCOMMAND_PICTURE, x, y, eDRAW_NORMAL, picture.width, picture.height, picture.rows, NULL, 0 };
+                this->Submit(pp, command);
               }
-            }
-          }
-        }
-        else if (((mode & eDRAW_FLIPPED_Y) == 0) && ((mode & eDRAW_FLIPPED_X) != 0)) {
-          int screen_row = y;
-          for (int row_index = clip_bottom; row_index >= clip_top; row_index--) {
-            for (int col_index = clip_left; col_index <= clip_right; col_index++) {
-              int pixel = picture.rows[picture.row_pointer + row_index][col_index]; // Skip meta data row.
-              if (pixel) {
-                this->screen[y + row_index][x + col_index] = pixel;
+              else { // The cache is full of chunks for this frame.
+                int chunk_left = std::max(chunk_x * CHUNK_SIZE, left);
+                int chunk_top = std::max(chunk_y * CHUNK_SIZE, top);
+                int chunk_right = std::min((chunk_x * CHUNK_SIZE) + CHUNK_SIZE - 1, right);
+                int chunk_bottom = std::min((chunk_y * CHUNK_SIZE) + CHUNK_SIZE - 1, bottom);
+                this->Render_Tiles(pp, chunk_left, chunk_top, chunk_right, chunk_bottom);
               }
             }
-            screen_row++;
           }
         }
-        else if (((mode & eDRAW_FLIPPED_X) == 0) && ((mode & eDRAW_FLIPPED_Y) == 0)) {
-          int screen_row = y;
-          for (int row_index = clip_bottom; row_index >= clip_top; row_index--) {
-            int screen_col = x;
-            for (int col_index = clip_right; col_index >= clip_left; col_index--) {
-              int pixel = picture.rows[picture.row_pointer + row_index][col_index]; // Skip meta data row.
-              if (pixel) {
-                this->screen[y + row_index][x + col_index] = pixel;
-              }
+        else {
+          this->Render_Tiles(pp, left, top, right, bottom);
+        }
+      }
+    }
+  }
+
+  /**
+   * Renders a block of tiles one by one. Each tile copies its opaque runs
+   * and clips them to the screen row by row.
+   * @param pp The picture processor to draw on.
+   * @param left The first column of tiles.
+   * @param top The first row of tiles.
+   * @param right The last column of tiles.
+   * @param bottom The last row of tiles.
+   * @throws An error if the map holds a tile that is not in the tile set.
+   */
+  template <typename T> void cTile_Map<T>::Render_Tiles(cBasic_Picture_Processor<T>& pp, int left, int top, int right, int bottom) {
+    sDraw_Command<T> command = { eCOMMAND_COMPILED_PICTURE, 0, 0, eDRAW_NORMAL, this->tile_width, this->tile_height, NULL, NULL, 0 };
+    for (int row_index = top; row_index <= bottom; row_index++) {
+      int* tile_row = this->map->rows[row_index];
+      command.y = (row_index * this->tile_height) - this->scroll_y;
+      for (int col_index = left; col_index <= right; col_index++) {
+        int tile = tile_row[col_index];
+        if (tile) {
+          command.x = (col_index * this->tile_width) - this->scroll_x;
+          command.picture = this->Get_Tile_Picture(tile);
+          this->Submit(pp, command);
+        }
+      }
+    }
+  }
+
+  /**
+   * Gets a chunk from the cache, building it if it is not there. The chunk
+   * used longest ago is replaced, but never one that was used this frame
+   * since a recorded command may still point at it.
+   * @param chunk_x The column of the chunk.
+   * @param chunk_y The row of the chunk.
+   * @return The chunk or NULL if every chunk was used this frame.
+   * @throws An error if the map holds a tile that is not in the tile set.
+   */
+  template <typename T> sTile_Chunk<T>* cTile_Map<T>::Get_Chunk(int chunk_x, int chunk_y) {
+    sTile_Chunk<T>* oldest = NULL;
+    for (int chunk_index = 0; chunk_index < MAX_CHUNKS; chunk_index++) {
+      sTile_Chunk<T>& chunk = this->chunks[chunk_index];
+      if ((chunk.chunk_x == chunk_x) && (chunk.chunk_y == chunk_y)) {
+        chunk.last_used = this->frame;
+        return &chunk;
+      }
+      if ((chunk.last_used != this->frame) && (!oldest || (chunk.last_used < oldest->last_used))) {
+        oldest = &chunk;
+      }
+    }
+    if (oldest) {
+      oldest->chunk_x = chunk_x;
+      oldest->chunk_y = chunk_y;
+      oldest->last_used = this->frame;
+      try {
+        this->Build_Chunk(*oldest);
+      }
+      catch (cError error) {
+        oldest->chunk_x = -1;
+        oldest->chunk_y = -1;
+        throw error;
+      }
+    }
+    return oldest;
+  }
+
+  /**
+   * Draws the tiles of a chunk into its picture. Chunks on the right and
+   * bottom edge of the map are cut to the tiles that are there.
+   * @param chunk The chunk to build.
+   * @throws An error if the map holds a tile that is not in the tile set.
+   */
+  template <typename T> void cTile_Map<T>::Build_Chunk(sTile_Chunk<T>& chunk) {
+    int left = chunk.chunk_x * CHUNK_SIZE;
+    int top = chunk.chunk_y * CHUNK_SIZE;
+    int cols = std::min((int)CHUNK_SIZE, this->map->width - left);
+    int rows = std::min((int)CHUNK_SIZE, this->map->height - top);
+    cBasic_Table<T>& picture = *chunk.picture;
+    picture.Resize(cols * this->tile_width, rows * this->tile_height);
+    for (int row_index = 0; row_index < rows; row_index++) {
+      int* tile_row = this->map->rows[top + row_index];
+      for (int col_index = 0; col_index < cols; col_index++) {
+        int tile = tile_row[left + col_index];
+        if (tile) {
+          cCompiled_Picture<T>& tile_picture = *this->Get_Tile_Picture(tile);
+          T* pixels = tile_picture.pixels[eDRAW_NORMAL].Data();
+          sPicture_Span* spans = tile_picture.spans[eDRAW_NORMAL].Data();
+          int* row_spans = tile_picture.row_spans[eDRAW_NORMAL].Data();
+          int x = col_index * this->tile_width;
+          for (int pixel_row = 0; pixel_row < this->tile_height; pixel_row++) {
+            T* target = picture.rows[(row_index * this->tile_height) + pixel_row] + x;
+            for (int span_index = row_spans[pixel_row]; span_index < row_spans[pixel_row + 1]; span_index++) {
+              sPicture_Span& span = spans[span_index];
+              std::memcpy(target + span.start, pixels + span.offset, span.length * sizeof(T));
             }
-            screen_row++;
           }
         }
-        else {
-          throw cError("Wrong drawing mode set for picture.");
-        }
       }
     }
   }
 
   /**
-   * Clears the screen to a specified color.
-   * @param color The color of the screen.
-   * @throws An error if the color is not on the palette.
+   * Gets the compiled picture of a tile.
+   * @param tile The index of the tile.
+   * @return The compiled picture.
+   * @throws An error if the tile is not in the tile set.
+   */
+  template <typename T> cCompiled_Picture<T>* cTile_Map<T>::Get_Tile_Picture(int tile) {
+    if ((tile < 1) || (tile > this->tiles.Count())) {
+      throw cError("Tile " + Number_To_Text(tile) + " is not in the tile set.");
+    }
+    return this->tiles.At_Unchecked(tile - 1);
+  }
+
+  /**
+   * Sends a draw command to the picture processor. It is recorded if the
+   * processor is recording and drawn right away otherwise. The dirty area
+   * was already marked by the render.
+   * @param pp The picture processor.
+   * @param command The draw command.
+   */
+  template <typename T> void cTile_Map<T>::Submit(cBasic_Picture_Processor<T>& pp, sDraw_Command<T>& command) {
+    if (pp.recording) {
+      pp.commands.Add(command);
+    }
+    else {
+      pp.Run_Command(command, 0, pp.height);
+    }
+  }
+
+  // **************************************************************************
+  // Atlas Packer Implementation
+  // **************************************************************************
+
+  /**
+   * Creates a packer for an empty atlas page. Rectangles are placed with the
+   * skyline bottom left rule, which keeps a list of the top edges of what has
+   * been placed and puts each new rectangle where its top ends up lowest.
+   * @param width The width of the page.
+   * @param height The height of the page.
    */
-  void cPicture_Processor::Clear_Screen(sColor color) {
-    int color_index = this->Scan_Palette(color);
-    for (int y = 0; y < this->height; y++) {
-      for (int x = 0; x < this->height; x++) {
-        this->screen[y][x] = color_index;
+  cAtlas_Packer::cAtlas_Packer(int width, int height) {
+    this->width = width;
+    this->height = height;
+    this->Clear();
+  }
+
+  /**
+   * Finds a place for a rectangle on the page.
+   * @param width The width of the rectangle.
+   * @param height The height of the rectangle.
+   * @param position Gets the top left corner of the rectangle if it fit.
+   * @return True if the rectangle fit, false if the page is too full.
+   */
+  bool cAtlas_Packer::Insert(int width, int height, sPoint& position) {
+    int best_index = -1;
+    int best_bottom = INT_MAX;
+    int best_width = INT_MAX;
+    int best_y = 0;
+    int node_count = this->skyline.Count();
+    for (int node_index = 0; node_index < node_count; node_index++) {
+      int y = this->Fit_Rectangle(node_index, width, height);
+      if (y >= 0) {
+        sSkyline_Node& node = this->skyline[node_index];
+        // Lowest top edge wins. Ties go to the narrowest ledge to waste less.
+        if (((y + height) < best_bottom) || (((y + height) == best_bottom) && (node.width < best_width))) {
+          best_index = node_index;
+          best_bottom = y + height;
+          best_width = node.width;
+          best_y = y;
+        }
       }
     }
+    if (best_index != -1) {
+      position.x = this->skyline[best_index].x;
+      position.y = best_y;
+      this->Add_Rectangle(best_index, position.x, position.y, width, height);
+      this->used_area += width * height;
+    }
+    return (best_index != -1);
   }
 
   /**
-   * Scans the palette looking for a color.
-   * @param color The color to look for.
-   * @return The color index.
-   * @throws An error if the color was not found.
+   * Tests if a rectangle fits with its left edge on a skyline node. It rests
+   * on the highest node under it.
+   * @param node_index The index of the node.
+   * @param width The width of the rectangle.
+   * @param height The height of the rectangle.
+   * @return The y coordinate of the rectangle or -1 if it does not fit.
    */
-  int cPicture_Processor::Scan_Palette(sColor color) {
-    int color_index = -1;
-    for (int entry_index = 0; entry_index < this->palette_size; entry_index++) {
-      sColor entry = this->palette[entry_index];
-      if ((color.red == entry.red) && (color.green == entry.green) && (color.blue == entry.blue)) {
-        color_index = entry_index;
+  int cAtlas_Packer::Fit_Rectangle(int node_index, int width, int height) {
+    int x = this->skyline[node_index].x;
+    if ((x + width) > this->width) {
+      return -1;
+    }
+    int y = 0;
+    int width_left = width;
+    while (width_left > 0) {
+      sSkyline_Node& node = this->skyline[node_index];
+      y = std::max(y, node.y);
+      if ((y + height) > this->height) {
+        return -1;
+      }
+      width_left -= node.width;
+      node_index++;
+    }
+    return y;
+  }
+
+  /**
+   * Raises the skyline over a placed rectangle. Nodes that the rectangle
+   * covers are cut back or removed and nodes at the same height are joined.
+   * @param node_index The index of the node the rectangle starts on.
+   * @param x The x coordinate of the rectangle.
+   * @param y The y coordinate of the rectangle.
+   * @param width The width of the rectangle.
+   * @param height The height of the rectangle.
+   */
+  void cAtlas_Packer::Add_Rectangle(int node_index, int x, int y, int width, int height) {
+    sSkyline_Node top = { x, y + height, width };
+    this->skyline.Insert(top, node_index);
+    int next_index = node_index + 1;
+    while (next_index < this->skyline.Count()) {
+      sSkyline_Node& prev = this->skyline[next_index - 1];
+      sSkyline_Node& node = this->skyline[next_index];
+      int overlap = (prev.x + prev.width) - node.x;
+      if (overlap <= 0) {
         break;
       }
+      node.x += overlap;
+      node.width -= overlap;
+      if (node.width > 0) {
+        break;
+      }
+      this->skyline.Remove(next_index);
+    }
+    for (int merge_index = 0; merge_index < (this->skyline.Count() - 1); ) {
+      sSkyline_Node& node = this->skyline[merge_index];
+      sSkyline_Node& next = this->skyline[merge_index + 1];
+      if (node.y == next.y) {
+        node.width += next.width;
+        this->skyline.Remove(merge_index + 1);
+      }
+      else {
+        merge_index++;
+      }
     }
-    if (color_index == -1) { // No color found.
-      throw cError("Color not found in palette.");
-    }
-    return color_index;
   }
 
   /**
-   * Dumps the picture processor.
+   * Empties the page.
    */
-  void cPicture_Processor::Dump() {
-    // Dump the palette.
-    std::cout << "*** palette ***" << std::endl;
-    for (int entry_index = 0; entry_index < this->palette_size; entry_index++) {
-      sColor entry = this->palette[entry_index];
-      std::cout << entry.red << "," << entry.green << "," << entry.blue << std::endl;
-    }
-    std::cout << "*** screen ***" << std::endl;
-    for (int row_index = 0; row_index < this->height; row_index++) {
-      for (int col_index = 0; col_index < this->width; col_index++) {
-        std::cout << this->screen[row_index][col_index];
-        if (col_index < (this->width - 1)) {
-          std::cout << " ";
-        }
-      }
-      std::cout << std::endl;
-    }
+  void cAtlas_Packer::Clear() {
+    sSkyline_Node floor = { 0, 0, this->width };
+    this->skyline.Clear();
+    this->skyline.Add(floor);
+    this->used_area = 0;
   }
 
   // **************************************************************************
@@ -2276,6 +5632,67 @@ namespace Nerd {
     }
   }
 
+  // **************************************************************************
+  // Component Store Implementation
+  // **************************************************************************
+
+  /**
+   * Compiles a component into the store. The component is stored at the same
+   * index it has in the layout's component hash.
+   * @param entity The component to compile.
+   */
+  void cComponent_Store::Add(tObject& entity) {
+    this->x.Add(entity[eATOM_X].number);
+    this->y.Add(entity[eATOM_Y].number);
+    this->width.Add(entity[eATOM_WIDTH].number);
+    this->height.Add(entity[eATOM_HEIGHT].number);
+  }
+
+  /**
+   * Clears out all compiled components.
+   */
+  void cComponent_Store::Clear() {
+    this->x.Clear();
+    this->y.Clear();
+    this->width.Clear();
+    this->height.Clear();
+  }
+
+  /**
+   * Gets the number of compiled components.
+   * @return The number of components.
+   */
+  int cComponent_Store::Count() {
+    return this->x.Count();
+  }
+
+  /**
+   * Finds the first component containing a point.
+   * @param point The point in screen coordinates.
+   * @param cell_w The width of a grid cell.
+   * @param cell_h The height of a grid cell.
+   * @return The index of the component or NO_VALUE_FOUND if no component contains the point.
+   */
+  int cComponent_Store::Find_Component(sPoint point, int cell_w, int cell_h) {
+    int* comp_x = this->x.Data();
+    int* comp_y = this->y.Data();
+    int* comp_width = this->width.Data();
+    int* comp_height = this->height.Data();
+    int comp_count = this->Count();
+    int found_index = NO_VALUE_FOUND;
+    for (int comp_index = 0; comp_index < comp_count; comp_index++) {
+      int left = comp_x[comp_index] * cell_w;
+      int top = comp_y[comp_index] * cell_h;
+      int right = left + (comp_width[comp_index] * cell_w) - 1;
+      int bottom = top + (comp_height[comp_index] * cell_h) - 1;
+      if ((point.x >= left) && (point.x <= right) && (point.y >= top) && (point.y <= bottom)) {
+        found_index = comp_index;
+        break;
+      }
+    }
+    return found_index;
+  }
+
   // **************************************************************************
   // Layout Implementation
   // **************************************************************************
@@ -2372,6 +5789,8 @@ namespace Nerd {
     for (int comp_index = 0; comp_index < comp_count; comp_index++) {
       this->On_Component_Init(this->components.values[comp_index]);
     }
+    // Initializers may move or retype components so compile them last.
+    this->Compile_Components();
   }
 
   /**
@@ -2398,54 +5817,54 @@ namespace Nerd {
    */
   void cLayout::Parse_Entity() {
     tObject entity;
-    entity["id"] = cValue("");
-    entity["type"] = cValue("");
-    entity["x"] = cValue(0);
-    entity["y"] = cValue(0);
-    entity["width"] = cValue(0);
-    entity["height"] = cValue(0);
+    entity[eATOM_ID] = cValue("");
+    entity[eATOM_TYPE] = cValue("");
+    entity[eATOM_X] = cValue(0);
+    entity[eATOM_Y] = cValue(0);
+    entity[eATOM_WIDTH] = cValue(0);
+    entity[eATOM_HEIGHT] = cValue(0);
     for (int cell_y = 0; cell_y < this->height; cell_y++) {
       for (int cell_x = 0; cell_x < this->width; cell_x++) {
         char cell = this->grid[cell_y][cell_x];
         if (cell == '+') {
-          entity["x"] = cell_x;
-          entity["y"] = cell_y;
-          entity["width"] = 1;
-          entity["height"] = 1;
-          entity["type"] = "box";
+          entity[eATOM_X] = cell_x;
+          entity[eATOM_Y] = cell_y;
+          entity[eATOM_WIDTH] = 1;
+          entity[eATOM_HEIGHT] = 1;
+          entity[eATOM_TYPE] = "box";
           this->Parse_Box(entity);
           // Break out of double loop.
           cell_y = this->height;
           break;
         }
         else if (cell == '[') {
-          entity["x"] = cell_x;
-          entity["y"] = cell_y;
-          entity["width"] = 1;
-          entity["height"] = 1;
-          entity["type"] = "field";
+          entity[eATOM_X] = cell_x;
+          entity[eATOM_Y] = cell_y;
+          entity[eATOM_WIDTH] = 1;
+          entity[eATOM_HEIGHT] = 1;
+          entity[eATOM_TYPE] = "field";
           this->Parse_Field(entity);
           // Break out of double loop.
           cell_y = this->height;
           break;
         }
         else if (cell == '{') {
-          entity["x"] = cell_x;
-          entity["y"] = cell_y;
-          entity["width"] = 1;
-          entity["height"] = 1;
-          entity["type"] = "panel";
+          entity[eATOM_X] = cell_x;
+          entity[eATOM_Y] = cell_y;
+          entity[eATOM_WIDTH] = 1;
+          entity[eATOM_HEIGHT] = 1;
+          entity[eATOM_TYPE] = "panel";
           this->Parse_Panel(entity);
           // Break out of double loop.
           cell_y = this->height;
           break;
         }
         else if (cell == '(') {
-          entity["x"] = cell_x;
-          entity["y"] = cell_y;
-          entity["width"] = 1;
-          entity["height"] = 1;
-          entity["type"] = "button";
+          entity[eATOM_X] = cell_x;
+          entity[eATOM_Y] = cell_y;
+          entity[eATOM_WIDTH] = 1;
+          entity[eATOM_HEIGHT] = 1;
+          entity[eATOM_TYPE] = "button";
           this->Parse_Button(entity);
           // Break out of double loop.
           cell_y = this->height;
@@ -2457,7 +5876,8 @@ namespace Nerd {
       }
     }
     // Add to components.
-    this->components[entity["id"].string] = entity;
+    std::string id = entity[eATOM_ID].string;
+    this->components[id] = std::move(entity);
   }
 
   /**
@@ -2467,8 +5887,8 @@ namespace Nerd {
    */
   void cLayout::Parse_Box(tObject& entity) {
     // We'll navigate in this path: right -> down -> left -> up
-    int pos_x = entity["x"].number; // Skip the plus.
-    int pos_y = entity["y"].number;
+    int pos_x = entity[eATOM_X].number; // Skip the plus.
+    int pos_y = entity[eATOM_Y].number;
     int rev_width = 1;
     int rev_height = 1;
     std::string id_str = "";
@@ -2479,8 +5899,8 @@ namespace Nerd {
     while (pos_x < this->width) {
       char cell = this->grid[pos_y][pos_x];
       if (cell == '+') {
-        entity["width"].number++;
-        entity["id"].string = id_str;
+        entity[eATOM_WIDTH].number++;
+        entity[eATOM_ID].string = id_str;
         this->grid[pos_y][pos_x] = ' ';
         break;
       }
@@ -2488,11 +5908,11 @@ namespace Nerd {
         if (this->Is_Identifier(cell)) {
           id_str += cell; // Collect ID letter.
         }
-        entity["width"].number++;
+        entity[eATOM_WIDTH].number++;
         this->grid[pos_y][pos_x] = ' ';
       }
       else if (cell == '-') { // The box's side.
-        entity["width"].number++;
+        entity[eATOM_WIDTH].number++;
       }
       else {
         throw cError("Not a valid box. (right)");
@@ -2508,12 +5928,12 @@ namespace Nerd {
     while (pos_y < this->height) {
       char cell = this->grid[pos_y][pos_x];
       if (cell == '+') {
-        entity["height"].number++;
+        entity[eATOM_HEIGHT].number++;
         this->grid[pos_y][pos_x] = ' ';
         break;
       }
       else if (cell == '|') {
-        entity["height"].number++;
+        entity[eATOM_HEIGHT].number++;
         this->grid[pos_y][pos_x] = ' ';
       }
       else {
@@ -2543,7 +5963,7 @@ namespace Nerd {
       }
       pos_x--;
     }
-    if (rev_width != entity["width"].number) {
+    if (rev_width != entity[eATOM_WIDTH].number) {
       throw cError("Not a valid box. (width mismatch)");
     }
     // Navigate up.
@@ -2564,7 +5984,7 @@ namespace Nerd {
       }
       pos_y--;
     }
-    if (rev_height != entity["height"].number) {
+    if (rev_height != entity[eATOM_HEIGHT].number) {
       throw cError("Not a valid box. (height mismatch)");
     }
   }
@@ -2575,8 +5995,8 @@ namespace Nerd {
    * @throws An error if the field is invalid.
    */
   void cLayout::Parse_Field(tObject& entity) {
-    int pos_x = entity["x"].number;
-    int pos_y = entity["y"].number;
+    int pos_x = entity[eATOM_X].number;
+    int pos_y = entity[eATOM_Y].number;
     std::string id_str = "";
     // Clear out initial bracket.
     this->grid[pos_y][pos_x] = ' ';
@@ -2585,8 +6005,8 @@ namespace Nerd {
     while (pos_x < this->width) {
       char cell = this->grid[pos_y][pos_x];
       if (cell == ']') {
-        entity["width"].number++;
-        entity["id"].string = id_str;
+        entity[eATOM_WIDTH].number++;
+        entity[eATOM_ID].string = id_str;
         this->grid[pos_y][pos_x] = ' ';
         break;
       }
@@ -2594,7 +6014,7 @@ namespace Nerd {
         if (this->Is_Identifier(cell)) {
           id_str += cell;
         }
-        entity["width"].number++;
+        entity[eATOM_WIDTH].number++;
         this->grid[pos_y][pos_x] = ' ';
       }
       else {
@@ -2614,8 +6034,8 @@ namespace Nerd {
    * @throws An error if the panel is invalid.
    */
   void cLayout::Parse_Panel(tObject& entity) {
-    int pos_x = entity["x"].number;
-    int pos_y = entity["y"].number;
+    int pos_x = entity[eATOM_X].number;
+    int pos_y = entity[eATOM_Y].number;
     std::string id_str = "";
     // Clear out initial curly.
     this->grid[pos_y][pos_x] = ' ';
@@ -2625,8 +6045,8 @@ namespace Nerd {
     while (pos_x < this->width) {
       char cell = this->grid[pos_y][pos_x];
       if (cell == '}') {
-        entity["width"].number++;
-        entity["id"].string = id_str;
+        entity[eATOM_WIDTH].number++;
+        entity[eATOM_ID].string = id_str;
         this->grid[pos_y][pos_x] = ' ';
         break;
       }
@@ -2634,7 +6054,7 @@ namespace Nerd {
         if (this->Is_Identifier(cell)) {
           id_str += cell;
         }
-        entity["width"].number++;
+        entity[eATOM_WIDTH].number++;
         this->grid[pos_y][pos_x] = ' ';
       }
       else {
@@ -2654,16 +6074,16 @@ namespace Nerd {
    * @throws An error if the button is invalid.
    */
   void cLayout::Parse_Button(tObject& entity) {
-    int pos_x = entity["x"].number;
-    int pos_y = entity["y"].number;
+    int pos_x = entity[eATOM_X].number;
+    int pos_y = entity[eATOM_Y].number;
     std::string id_str = "";
     this->grid[pos_y][pos_x] = ' ';
     pos_x++;
     while (pos_x < this->width) {
       char cell = this->grid[pos_y][pos_x];
       if (cell == ')') {
-        entity["width"].number++;
-        entity["id"].string = id_str;
+        entity[eATOM_WIDTH].number++;
+        entity[eATOM_ID].string = id_str;
         this->grid[pos_y][pos_x] = ' ';
         break;
       }
@@ -2671,7 +6091,7 @@ namespace Nerd {
         if (this->Is_Identifier(cell)) {
           id_str += cell;
         }
-        entity["width"].number++;
+        entity[eATOM_WIDTH].number++;
         this->grid[pos_y][pos_x] = ' ';
       }
       else {
@@ -2698,18 +6118,19 @@ namespace Nerd {
         std::string entity_id = pair[0];
         std::string value = pair[1];
         if (this->components.Does_Key_Exist(entity_id)) {
-          cArray<std::string> props = Parse_Sausage_Text(value, ",");
-          int prop_count = props.Count();
-          for (int prop_index = 0; prop_index < prop_count; prop_index++) {
-            cArray<std::string> prop = Parse_Sausage_Text(props[prop_index], "=");
-            if (prop.Count() == 2) {
-              std::string name = prop[0];
-              std::string value = prop[1];
-              try {
-                this->components[entity_id][name] = cValue(Text_To_Number(value));
+          tObject& entity = this->components[entity_id];
+          cTokenizer props(value, ',');
+          std::string_view prop_text;
+          while (props.Next(prop_text)) {
+            std::string_view prop[2];
+            if (cTokenizer(prop_text, '=').Split(prop, 2) == 2) {
+              std::string name(prop[0]);
+              int number = 0;
+              if (Try_Text_To_Number(prop[1], number) == eNUMBER_OK) {
+                entity[name] = cValue(number);
               }
-              catch (cError number_error) { // A string.
-                this->components[entity_id][name] = cValue(value);
+              else { // A string.
+                entity[name] = cValue(std::string(prop[1]));
               }
             }
             else {
@@ -2727,6 +6148,18 @@ namespace Nerd {
     }
   }
 
+  /**
+   * Compiles the components into the component store. This needs to be called
+   * again if a component's geometry is changed.
+   */
+  void cLayout::Compile_Components() {
+    this->store.Clear();
+    int comp_count = this->components.Count();
+    for (int comp_index = 0; comp_index < comp_count; comp_index++) {
+      this->store.Add(this->components.values[comp_index]);
+    }
+  }
+
   /**
    * Renders the entities.
    */
@@ -2746,22 +6179,23 @@ namespace Nerd {
     else {
       this->key = signal.code;
     }
-    for (int entity_index = 0; entity_index < entity_count; entity_index++) {
-      tObject& entity = this->components.values[entity_index];
-      if (signal.code == eSIGNAL_MOUSE) {
-        sRectangle bump_map = this->Get_Entity_Dimensions(entity);
-        if (Is_Point_In_Box(signal.coords, bump_map) && ((signal.button == eBUTTON_LEFT) || (signal.button == eBUTTON_RIGHT)) && this->not_clicked) { // Input focus.
+    if ((signal.code == eSIGNAL_MOUSE) && (entity_count > 0)) {
+      if (((signal.button == eBUTTON_LEFT) || (signal.button == eBUTTON_RIGHT)) && this->not_clicked) {
+        int entity_index = this->store.Find_Component(signal.coords, this->cell_w, this->cell_h);
+        if (entity_index != NO_VALUE_FOUND) { // Input focus.
           this->sel_component = this->components.keys[entity_index];
           this->clicked = this->components.keys[entity_index];
           // Normalize mouse coordinates to entity space.
-          this->mouse_coords.x = signal.coords.x - (entity["x"].number * this->cell_w);
-          this->mouse_coords.y = signal.coords.y - (entity["y"].number * this->cell_h);
+          this->mouse_coords.x = signal.coords.x - (this->store.x[entity_index] * this->cell_w);
+          this->mouse_coords.y = signal.coords.y - (this->store.y[entity_index] * this->cell_h);
           this->not_clicked = false;
         }
-        else if (signal.button == eBUTTON_UP) {
-          this->not_clicked = true;
-        }
       }
+      else if (signal.button == eBUTTON_UP) {
+        this->not_clicked = true;
+      }
+    }
+    for (int entity_index = 0; entity_index < entity_count; entity_index++) {
       this->io->Set_Canvas_Target();
       this->On_Component_Render(this->components.values[entity_index]);
     }
@@ -2792,10 +6226,10 @@ namespace Nerd {
    */
   sRectangle cLayout::Get_Entity_Dimensions(tObject& entity) {
     sRectangle dimensions;
-    dimensions.left = entity["x"].number * this->cell_w;
-    dimensions.top = entity["y"].number * this->cell_h;
-    dimensions.right = dimensions.left + (entity["width"].number * this->cell_w) - 1;
-    dimensions.bottom = dimensions.top + (entity["height"].number * this->cell_h) - 1;
+    dimensions.left = entity[eATOM_X].number * this->cell_w;
+    dimensions.top = entity[eATOM_Y].number * this->cell_h;
+    dimensions.right = dimensions.left + (entity[eATOM_WIDTH].number * this->cell_w) - 1;
+    dimensions.bottom = dimensions.top + (entity[eATOM_HEIGHT].number * this->cell_h) - 1;
     return dimensions;
   }
 
@@ -2838,16 +6272,16 @@ namespace Nerd {
    * @param entity The entity that is initialized.
    */
   void cPage::On_Component_Init(tObject& entity) {
-    if (entity["type"].string == "field") {
+    if (entity[eATOM_TYPE].string == "field") {
       this->Init_Field(entity);
     }
-    else if (entity["type"].string == "grid-view") {
+    else if (entity[eATOM_TYPE].string == "grid-view") {
       this->Init_Grid_View(entity);
     }
-    else if (entity["type"].string == "list") {
+    else if (entity[eATOM_TYPE].string == "list") {
       this->Init_List(entity);
     }
-    else if (entity["type"].string == "toolbar") {
+    else if (entity[eATOM_TYPE].string == "toolbar") {
       this->Init_Toolbar(entity);
     }
   }
@@ -2859,26 +6293,26 @@ namespace Nerd {
   void cPage::On_Component_Render(tObject& entity) {
     // Clear out the component. Make background white.
     this->io->Color(255, 255, 255);
-    if (entity["type"].string == "field") {
+    if (entity[eATOM_TYPE].string == "field") {
       this->Render_Field(entity);
     }
-    else if (entity["type"].string == "label") {
+    else if (entity[eATOM_TYPE].string == "label") {
       this->Render_Label(entity);
     }
-    else if (entity["type"].string == "grid-view") {
+    else if (entity[eATOM_TYPE].string == "grid-view") {
       this->Render_Grid_View(entity);
     }
-    else if (entity["type"].string == "button") {
+    else if (entity[eATOM_TYPE].string == "button") {
       this->Render_Button(entity);
     }
-    else if (entity["type"].string == "toolbar") {
+    else if (entity[eATOM_TYPE].string == "toolbar") {
       this->Render_Toolbar(entity);
     }
-    else if (entity["type"].string == "list") {
+    else if (entity[eATOM_TYPE].string == "list") {
       this->Render_List(entity);
     }
     // Draw the canvas of the component.
-    this->io->Draw_Canvas(entity["x"].number * this->cell_w, entity["y"].number * this->cell_h, entity["width"].number * this->cell_w, entity["height"].number * this->cell_h);
+    this->io->Draw_Canvas(entity[eATOM_X].number * this->cell_w, entity[eATOM_Y].number * this->cell_h, entity[eATOM_WIDTH].number * this->cell_w, entity[eATOM_HEIGHT].number * this->cell_h);
   }
 
   /**
@@ -2893,7 +6327,7 @@ namespace Nerd {
    * @param entity The field entity.
    */
   void cPage::Init_Field(tObject& entity) {
-    entity["text"].Set_String("");
+    entity[eATOM_TEXT].Set_String("");
   }
 
   /**
@@ -2901,31 +6335,31 @@ namespace Nerd {
    * @param entity The field component.
    */
   void cPage::Render_Field(tObject& entity) {
-    int dy = ((entity["height"].number * this->cell_h) - this->io->Get_Text_Height(entity["text"].string)) / 2;
-    int width = this->io->Get_Text_Width(entity["text"].string);
+    int dy = ((entity[eATOM_HEIGHT].number * this->cell_h) - this->io->Get_Text_Height(entity[eATOM_TEXT].string)) / 2;
+    int width = this->io->Get_Text_Width(entity[eATOM_TEXT].string);
     int char_w = this->io->Get_Text_Width("X");
-    int limit = (entity["width"].number * this->cell_w) - 2 - char_w; // Don't allow extra character.
-    if (this->sel_component == entity["id"].string) { // Does field have input focus?
+    int limit = (entity[eATOM_WIDTH].number * this->cell_w) - 2 - char_w; // Don't allow extra character.
+    if (this->sel_component == entity[eATOM_ID].string) { // Does field have input focus?
       if ((this->key >= ' ') && (this->key <= '~')) {
         if (width < limit) { // Only allow text if input has space.
-          entity["text"].string += (char)this->key;
+          entity[eATOM_TEXT].string += (char)this->key;
         }
       }
       else if (this->key == eSIGNAL_BACKSPACE) {
-        entity["text"].string = entity["text"].string.substr(0, entity["text"].string.length() - 1); // Decrease string.
+        entity[eATOM_TEXT].string = entity[eATOM_TEXT].string.substr(0, entity[eATOM_TEXT].string.length() - 1); // Decrease string.
       }
       else if (this->key == eSIGNAL_DELETE) {
-        entity["text"].string = ""; // Clear out
+        entity[eATOM_TEXT].string = ""; // Clear out
       }
       // Highlight the field.
-      this->io->Box(0, 0, entity["width"].number * this->cell_w, entity["height"].number * this->cell_h, 0, 255, 0);
+      this->io->Box(0, 0, entity[eATOM_WIDTH].number * this->cell_w, entity[eATOM_HEIGHT].number * this->cell_h, 0, 255, 0);
     }
     else {
-      this->io->Box(0, 0, entity["width"].number * this->cell_w, entity["height"].number * this->cell_h, 0, 0, 0);
+      this->io->Box(0, 0, entity[eATOM_WIDTH].number * this->cell_w, entity[eATOM_HEIGHT].number * this->cell_h, 0, 0, 0);
     }
     // Render the field.
-    this->io->Box(1, 1, entity["width"].number * this->cell_w - 2, entity["height"].number * this->cell_h - 2, 255, 255, 255);
-    this->io->Output_Text(entity["text"].string, 2, dy, 0, 0, 0);
+    this->io->Box(1, 1, entity[eATOM_WIDTH].number * this->cell_w - 2, entity[eATOM_HEIGHT].number * this->cell_h - 2, 255, 255, 255);
+    this->io->Output_Text(entity[eATOM_TEXT].string, 2, dy, 0, 0, 0);
   }
 
   /**
@@ -2933,13 +6367,13 @@ namespace Nerd {
    * @param entity The grid view entity.
    */
   void cPage::Init_Grid_View(tObject& entity) {
-    Check_Condition(entity.Does_Key_Exist("columns"), "No column count specified for grid view.");
-    Check_Condition(entity.Does_Key_Exist("rows"), "No row count specified for grid view.");
-    entity["grid-x"].Set_Number(NO_VALUE_FOUND);
-    entity["grid-y"].Set_Number(NO_VALUE_FOUND);
-    entity["scroll-x"].Set_Number(0);
-    entity["scroll-y"].Set_Number(0);
-    entity["text"].Set_String("");
+    Check_Condition(entity.Does_Key_Exist(eATOM_COLUMNS), "No column count specified for grid view.");
+    Check_Condition(entity.Does_Key_Exist(eATOM_ROWS), "No row count specified for grid view.");
+    entity[eATOM_GRID_X].Set_Number(NO_VALUE_FOUND);
+    entity[eATOM_GRID_Y].Set_Number(NO_VALUE_FOUND);
+    entity[eATOM_SCROLL_X].Set_Number(0);
+    entity[eATOM_SCROLL_Y].Set_Number(0);
+    entity[eATOM_TEXT].Set_String("");
     this->Clear_Grid(entity);
   }
 
@@ -2948,26 +6382,33 @@ namespace Nerd {
    * @param entity The grid view entity.
    */
   void cPage::Render_Grid_View(tObject& entity) {
-    int row_count = entity["rows"].number;
-    int col_count = entity["columns"].number;
-    int cell_width = (entity["width"].number * this->cell_w) / col_count;
-    int cell_height = this->io->Get_Text_Height(entity["text"].string) + 4;
+    int row_count = entity[eATOM_ROWS].number;
+    int col_count = entity[eATOM_COLUMNS].number;
+    int cell_width = (entity[eATOM_WIDTH].number * this->cell_w) / col_count;
+    int cell_height = this->io->Get_Text_Height(entity[eATOM_TEXT].string) + 4;
     int highlight = 0;
-    cArray<std::string> rows = Parse_Sausage_Text(entity["text"].string, ";");
+    // Walk a copy of the grid text so edits can be spliced into the entity.
+    std::string grid_text = entity[eATOM_TEXT].string;
+    int splice_delta = 0;
+    cTokenizer rows(grid_text, ';');
     for (int grid_y = 0; grid_y < row_count; grid_y++) {
-      cArray<std::string> cells = Parse_Sausage_Text(rows[grid_y], ",");
+      std::string_view row;
+      Check_Condition(rows.Next(row), "Grid view is missing rows.");
+      cTokenizer cells(row, ',');
       for (int grid_x = 0; grid_x < col_count; grid_x++) {
-        std::string& text = cells[grid_x];
-        if (this->sel_component == entity["id"].string) { // Does field have input focus?
-          sRectangle cell_map = { grid_x * cell_width - entity["scroll-x"].number,
-                                  grid_y * cell_height - entity["scroll-y"].number,
-                                  grid_x * cell_width + cell_width - 1 - entity["scroll-x"].number,
-                                  grid_y * cell_height + cell_height - 1 - entity["scroll-y"].number };
-          if (Is_Point_In_Box(this->mouse_coords, cell_map) && (this->clicked == entity["id"].string)) { // Check to see if we clicked into the cell.
-            entity["grid-x"].Set_Number(grid_x); // Set selected grid cell.
-            entity["grid-y"].Set_Number(grid_y);
+        std::string_view cell;
+        Check_Condition(cells.Next(cell), "Grid view is missing columns.");
+        std::string text(cell);
+        if (this->sel_component == entity[eATOM_ID].string) { // Does field have input focus?
+          sRectangle cell_map = { grid_x * cell_width - entity[eATOM_SCROLL_X].number,
+                                  grid_y * cell_height - entity[eATOM_SCROLL_Y].number,
+                                  grid_x * cell_width + cell_width - 1 - entity[eATOM_SCROLL_X].number,
+                                  grid_y * cell_height + cell_height - 1 - entity[eATOM_SCROLL_Y].number };
+          if (Is_Point_In_Box(this->mouse_coords, cell_map) && (this->clicked == entity[eATOM_ID].string)) { // Check to see if we clicked into the cell.
+            entity[eATOM_GRID_X].Set_Number(grid_x); // Set selected grid cell.
+            entity[eATOM_GRID_Y].Set_Number(grid_y);
           }
-          if ((entity["grid-x"].number == grid_x) && (entity["grid-y"].number == grid_y)) { // Do we have a selected grid cell.
+          if ((entity[eATOM_GRID_X].number == grid_x) && (entity[eATOM_GRID_Y].number == grid_y)) { // Do we have a selected grid cell.
             if ((this->key >= ' ') && (this->key <= '~')) {
               int width = this->io->Get_Text_Width(text);
               int char_w = this->io->Get_Text_Width("X");
@@ -2991,16 +6432,17 @@ namespace Nerd {
             if (text.length() == 0) {
               text = "free"; // Replace with free text.
             }
-            rows[grid_y] = Join(cells, ",");
-            entity["text"].Set_String(Join(rows, ";"));
+            int offset = (cell.data() - grid_text.data()) + splice_delta;
+            entity[eATOM_TEXT].string.replace(offset, cell.length(), text);
+            splice_delta += (int)text.length() - (int)cell.length();
             highlight = 255;
           }
           else {
             highlight = 0;
           }
         }
-        this->io->Box(grid_x * cell_width - entity["scroll-x"].number, grid_y * cell_height - entity["scroll-y"].number, cell_width, cell_height, 255, 255, 255);
-        this->io->Output_Text(text, grid_x * cell_width + 2 - entity["scroll-x"].number, grid_y * cell_height + 2 - entity["scroll-y"].number, 0, highlight, 0);
+        this->io->Box(grid_x * cell_width - entity[eATOM_SCROLL_X].number, grid_y * cell_height - entity[eATOM_SCROLL_Y].number, cell_width, cell_height, 255, 255, 255);
+        this->io->Output_Text(text, grid_x * cell_width + 2 - entity[eATOM_SCROLL_X].number, grid_y * cell_height + 2 - entity[eATOM_SCROLL_Y].number, 0, highlight, 0);
       }
     }
     // Allow scrolling of component.
@@ -3012,11 +6454,11 @@ namespace Nerd {
    * @param entity The label entity.
    */
   void cPage::Render_Label(tObject& entity) {
-    Check_Condition(entity.Does_Key_Exist("label"), "No label specified for label.");
-    Check_Condition(entity.Does_Key_Exist("red"), "Red component missing for label color.");
-    Check_Condition(entity.Does_Key_Exist("green"), "Green component missing for label color.");
-    Check_Condition(entity.Does_Key_Exist("blue"), "Blue component missing for label color.");
-    this->io->Output_Text(entity["label"].string, 0, 0, entity["red"].number, entity["green"].number, entity["blue"].number);
+    Check_Condition(entity.Does_Key_Exist(eATOM_LABEL), "No label specified for label.");
+    Check_Condition(entity.Does_Key_Exist(eATOM_RED), "Red component missing for label color.");
+    Check_Condition(entity.Does_Key_Exist(eATOM_GREEN), "Green component missing for label color.");
+    Check_Condition(entity.Does_Key_Exist(eATOM_BLUE), "Blue component missing for label color.");
+    this->io->Output_Text(entity[eATOM_LABEL].string, 0, 0, entity[eATOM_RED].number, entity[eATOM_GREEN].number, entity[eATOM_BLUE].number);
   }
 
   /**
@@ -3024,13 +6466,21 @@ namespace Nerd {
    * @param entity The list entity.
    */
   void cPage::Init_List(tObject& entity) {
-    entity["scroll-x"].Set_Number(0);
-    entity["scroll-y"].Set_Number(0);
-    entity["text"].Set_String("");
-    entity["sel-item"].Set_Number(NO_VALUE_FOUND);
-    if (entity.Does_Key_Exist("items")) {
-      cArray<std::string> items = Parse_Sausage_Text(entity["items"].string, ";");
-      entity["text"].Set_String(Join(items, ","));
+    entity[eATOM_SCROLL_X].Set_Number(0);
+    entity[eATOM_SCROLL_Y].Set_Number(0);
+    entity[eATOM_TEXT].Set_String("");
+    entity[eATOM_SEL_ITEM].Set_Number(NO_VALUE_FOUND);
+    if (entity.Does_Key_Exist(eATOM_ITEMS)) {
+      cTokenizer items(entity[eATOM_ITEMS].string, ';');
+      std::string text;
+      std::string_view item;
+      while (items.Next(item)) {
+        if (text.length() > 0) {
+          text += ',';
+        }
+        text += item;
+      }
+      entity[eATOM_TEXT].Set_String(std::move(text));
     }
   }
 
@@ -3039,24 +6489,25 @@ namespace Nerd {
    * @param entity The entity component.
    */
   void cPage::Render_List(tObject& entity) {
-    cArray<std::string> items = Parse_Sausage_Text(entity["text"].string, ",");
-    int item_count = items.Count();
-    int height = this->io->Get_Text_Height(entity["text"].string) + 2;
-    for (int item_index = 0; item_index < item_count; item_index++) {
-      std::string item = items[item_index];
+    std::string list_text = entity[eATOM_TEXT].string; // The click handler may change the list.
+    cTokenizer items(list_text, ',');
+    int height = this->io->Get_Text_Height(list_text) + 2;
+    std::string_view item_text;
+    for (int item_index = 0; items.Next(item_text); item_index++) {
+      std::string item(item_text);
       int highlight = 0;
-      if (entity["sel-item"].number == item_index) {
+      if (entity[eATOM_SEL_ITEM].number == item_index) {
         highlight = 255;
       }
-      this->io->Box(0 - entity["scroll-x"].number, item_index * height - entity["scroll-y"].number, entity["width"].number * this->cell_w, height, 255, 255, 255);
-      this->io->Output_Text(item, 2 - entity["scroll-x"].number, item_index * height + 2 - entity["scroll-y"].number, 0, highlight, 0);
-      if (this->clicked == entity["id"].string) { // Was item clicked?
+      this->io->Box(0 - entity[eATOM_SCROLL_X].number, item_index * height - entity[eATOM_SCROLL_Y].number, entity[eATOM_WIDTH].number * this->cell_w, height, 255, 255, 255);
+      this->io->Output_Text(item, 2 - entity[eATOM_SCROLL_X].number, item_index * height + 2 - entity[eATOM_SCROLL_Y].number, 0, highlight, 0);
+      if (this->clicked == entity[eATOM_ID].string) { // Was item clicked?
         sRectangle item_map = { 0,
-                                item_index * height - entity["scroll-y"].number,
-                                entity["width"].number * this->cell_w - 1,
-                                item_index * height + height - 1 - entity["scroll-y"].number };
+                                item_index * height - entity[eATOM_SCROLL_Y].number,
+                                entity[eATOM_WIDTH].number * this->cell_w - 1,
+                                item_index * height + height - 1 - entity[eATOM_SCROLL_Y].number };
         if (Is_Point_In_Box(this->mouse_coords, item_map)) { // Was item clicked on?
-          entity["sel-item"].Set_Number(item_index);
+          entity[eATOM_SEL_ITEM].Set_Number(item_index);
           this->On_List_Click(entity, item);
         }
       }
@@ -3069,15 +6520,15 @@ namespace Nerd {
    * @param entity The button entity.
    */
   void cPage::Render_Button(tObject& entity) {
-    Check_Condition(entity.Does_Key_Exist("label"), "No label for button.");
-    Check_Condition(entity.Does_Key_Exist("red"), "Missing red component for button color.");
-    Check_Condition(entity.Does_Key_Exist("green"), "Missing green component for button color.");
-    Check_Condition(entity.Does_Key_Exist("blue"), "Missing blue component for button color.");
-    int dx = (entity["width"].number * this->cell_w - this->io->Get_Text_Width(entity["label"].string)) / 2;
-    int dy = (entity["height"].number * this->cell_h - this->io->Get_Text_Height(entity["label"].string)) / 2;
-    this->io->Box(0, 0, entity["width"].number * this->cell_w, entity["height"].number * this->cell_h, entity["red"].number, entity["green"].number, entity["blue"].number);
-    this->io->Output_Text(entity["label"].string, dx, dy, 255, 255, 255); // White
-    if (this->clicked == entity["id"].string) { // Was the button clicked?
+    Check_Condition(entity.Does_Key_Exist(eATOM_LABEL), "No label for button.");
+    Check_Condition(entity.Does_Key_Exist(eATOM_RED), "Missing red component for button color.");
+    Check_Condition(entity.Does_Key_Exist(eATOM_GREEN), "Missing green component for button color.");
+    Check_Condition(entity.Does_Key_Exist(eATOM_BLUE), "Missing blue component for button color.");
+    int dx = (entity[eATOM_WIDTH].number * this->cell_w - this->io->Get_Text_Width(entity[eATOM_LABEL].string)) / 2;
+    int dy = (entity[eATOM_HEIGHT].number * this->cell_h - this->io->Get_Text_Height(entity[eATOM_LABEL].string)) / 2;
+    this->io->Box(0, 0, entity[eATOM_WIDTH].number * this->cell_w, entity[eATOM_HEIGHT].number * this->cell_h, entity[eATOM_RED].number, entity[eATOM_GREEN].number, entity[eATOM_BLUE].number);
+    this->io->Output_Text(entity[eATOM_LABEL].string, dx, dy, 255, 255, 255); // White
+    if (this->clicked == entity[eATOM_ID].string) { // Was the button clicked?
       this->On_Button_Click(entity);
     }
   }
@@ -3095,15 +6546,23 @@ namespace Nerd {
    * @param entity The toolbar entity.
    */
   void cPage::Init_Toolbar(tObject& entity) {
-    Check_Condition(entity.Does_Key_Exist("columns"), "No column count specified for toolbar.");
-    entity["scroll-x"].Set_Number(0);
-    entity["scroll-y"].Set_Number(0);
-    entity["text"].Set_String("");
-    entity["item-x"].Set_Number(NO_VALUE_FOUND);
-    entity["item-y"].Set_Number(NO_VALUE_FOUND);
-    if (entity.Does_Key_Exist("items")) {
-      cArray<std::string> items = Parse_Sausage_Text(entity["items"].string, ";");
-      entity["text"].Set_String(Join(items, ","));
+    Check_Condition(entity.Does_Key_Exist(eATOM_COLUMNS), "No column count specified for toolbar.");
+    entity[eATOM_SCROLL_X].Set_Number(0);
+    entity[eATOM_SCROLL_Y].Set_Number(0);
+    entity[eATOM_TEXT].Set_String("");
+    entity[eATOM_ITEM_X].Set_Number(NO_VALUE_FOUND);
+    entity[eATOM_ITEM_Y].Set_Number(NO_VALUE_FOUND);
+    if (entity.Does_Key_Exist(eATOM_ITEMS)) {
+      cTokenizer items(entity[eATOM_ITEMS].string, ';');
+      std::string text;
+      std::string_view item;
+      while (items.Next(item)) {
+        if (text.length() > 0) {
+          text += ',';
+        }
+        text += item;
+      }
+      entity[eATOM_TEXT].Set_String(std::move(text));
     }
   }
 
@@ -3112,41 +6571,41 @@ namespace Nerd {
    * @param entity The toolbar entity.
    */
   void cPage::Render_Toolbar(tObject& entity) {
-    cArray<std::string> items = Parse_Sausage_Text(entity["text"].string, ",");
-    int item_count = items.Count();
-    int cell_width = (entity["width"].number * this->cell_w) / entity["columns"].number;
+    std::string toolbar_text = entity[eATOM_TEXT].string; // The click handler may change the toolbar.
+    cTokenizer items(toolbar_text, ',');
+    int cell_width = (entity[eATOM_WIDTH].number * this->cell_w) / entity[eATOM_COLUMNS].number;
     int grid_x = 0;
     int grid_y = 0;
-    for (int item_index = 0; item_index < item_count; item_index++) {
-      std::string item = items[item_index];
-      cArray<std::string> pair = Parse_Sausage_Text(item, ":");
-      Check_Condition((pair.Count() == 2), "Invalid data format in toolbar item.");
-      std::string label = pair[0];
-      std::string icon = pair[1];
+    std::string_view item;
+    for (int item_index = 0; items.Next(item); item_index++) {
+      std::string_view pair[2];
+      Check_Condition((cTokenizer(item, ':').Split(pair, 2) == 2), "Invalid data format in toolbar item.");
+      std::string label(pair[0]);
+      std::string icon(pair[1]);
       int image_width = this->io->Get_Image_Width(icon);
       int image_height = this->io->Get_Image_Height(icon);
       int dx = (cell_width - image_width) / 2;
       int dy = (cell_width - image_height) / 2;
       int text_x = (cell_width - this->io->Get_Text_Width(label)) / 2;
       int text_y = dy + image_height + 1;
-      if (this->clicked == entity["id"].string) {
-        sRectangle box = { grid_x * cell_width - entity["scroll-x"].number,
-                           grid_y * cell_width - entity["scroll-y"].number,
-                           grid_x * cell_width + cell_width - 1 - entity["scroll-x"].number,
-                           grid_y * cell_width + cell_width - 1 - entity["scroll-y"].number };
+      if (this->clicked == entity[eATOM_ID].string) {
+        sRectangle box = { grid_x * cell_width - entity[eATOM_SCROLL_X].number,
+                           grid_y * cell_width - entity[eATOM_SCROLL_Y].number,
+                           grid_x * cell_width + cell_width - 1 - entity[eATOM_SCROLL_X].number,
+                           grid_y * cell_width + cell_width - 1 - entity[eATOM_SCROLL_Y].number };
         if (Is_Point_In_Box(this->mouse_coords, box)) {
-          entity["item-x"].Set_Number(grid_x);
-          entity["item-y"].Set_Number(grid_y);
+          entity[eATOM_ITEM_X].Set_Number(grid_x);
+          entity[eATOM_ITEM_Y].Set_Number(grid_y);
           this->On_Toolbar_Click(entity, label);
         }
       }
       int highlight = 0;
-      if ((entity["item-x"].number == grid_x) && (entity["item-y"].number == grid_y)) {
+      if ((entity[eATOM_ITEM_X].number == grid_x) && (entity[eATOM_ITEM_Y].number == grid_y)) {
         highlight = 255;
       }
-      this->io->Draw_Image(icon, (grid_x * cell_width) + dx - entity["scroll-x"].number, (grid_y * cell_width) + dy - entity["scroll-y"].number, image_width, image_height, 0, false, false);
-      this->io->Output_Text(label, (grid_x * cell_width) + text_x - entity["scroll-x"].number, (grid_y * cell_width) + text_y - entity["scroll-y"].number, 0, highlight, 0);
-      if (((item_index + 1) % entity["columns"].number) == 0) { // Go to next row.
+      this->io->Draw_Image(icon, (grid_x * cell_width) + dx - entity[eATOM_SCROLL_X].number, (grid_y * cell_width) + dy - entity[eATOM_SCROLL_Y].number, image_width, image_height, 0, false, false);
+      this->io->Output_Text(label, (grid_x * cell_width) + text_x - entity[eATOM_SCROLL_X].number, (grid_y * cell_width) + text_y - entity[eATOM_SCROLL_Y].number, 0, highlight, 0);
+      if (((item_index + 1) % entity[eATOM_COLUMNS].number) == 0) { // Go to next row.
         grid_y++;
         grid_x = 0;
       }
@@ -3180,24 +6639,24 @@ namespace Nerd {
    * @param entity The component to scroll.
    */
   void cPage::Scroll_Component(tObject& entity) {
-    Check_Condition(entity.Does_Key_Exist("scroll-x"), "Scroll x coordinate missing.");
-    Check_Condition(entity.Does_Key_Exist("scroll-y"), "Scroll y coordinate missing.");
-    if (this->sel_component == entity["id"].string) { // Input focus?
+    Check_Condition(entity.Does_Key_Exist(eATOM_SCROLL_X), "Scroll x coordinate missing.");
+    Check_Condition(entity.Does_Key_Exist(eATOM_SCROLL_Y), "Scroll y coordinate missing.");
+    if (this->sel_component == entity[eATOM_ID].string) { // Input focus?
       switch (this->key) {
         case eSIGNAL_LEFT: {
-          entity["scroll-x"].number -= this->cell_w;
+          entity[eATOM_SCROLL_X].number -= this->cell_w;
           break;
         }
         case eSIGNAL_RIGHT: {
-          entity["scroll-x"].number += this->cell_w;
+          entity[eATOM_SCROLL_X].number += this->cell_w;
           break;
         }
         case eSIGNAL_UP: {
-          entity["scroll-y"].number -= this->cell_h;
+          entity[eATOM_SCROLL_Y].number -= this->cell_h;
           break;
         }
         case eSIGNAL_DOWN: {
-          entity["scroll-y"].number += this->cell_h;
+          entity[eATOM_SCROLL_Y].number += this->cell_h;
         }
       }
     }
@@ -3210,8 +6669,8 @@ namespace Nerd {
   void cPage::Clear_Grid(tObject& entity) {
     // Allocate new rows.
     cArray<std::string> rows;
-    int row_count = entity["rows"].number;
-    int col_count = entity["columns"].number;
+    int row_count = entity[eATOM_ROWS].number;
+    int col_count = entity[eATOM_COLUMNS].number;
     for (int grid_y = 0; grid_y < row_count; grid_y++) {
       cArray<std::string> cells;
       for (int grid_x = 0; grid_x < col_count; grid_x++) {
@@ -3219,7 +6678,7 @@ namespace Nerd {
       }
       rows.Add(Join(cells, ","));
     }
-    entity["text"].Set_String(Join(rows, ";"));
+    entity[eATOM_TEXT].Set_String(Join(rows, ";"));
   }
 
   /**
@@ -3229,9 +6688,9 @@ namespace Nerd {
    * @throws An error if the rectangle is not valid.
    */
   sRectangle cPage::Parse_Rectangle(std::string text) {
-    cArray<std::string> str_rect = Parse_Sausage_Text(text, ",");
+    std::string_view str_rect[4];
     sRectangle rect;
-    Check_Condition((str_rect.Count() == 4), "Rectangle is not formatted correctly.");
+    Check_Condition((cTokenizer(text, ',').Split(str_rect, 4) == 4), "Rectangle is not formatted correctly.");
     rect.left = Text_To_Number(str_rect[0]);
     rect.top = Text_To_Number(str_rect[1]);
     rect.right = Text_To_Number(str_rect[2]);
@@ -3248,23 +6707,14 @@ namespace Nerd {
    * @throws An error if an invalid cell is accessed.
    */
   std::string cPage::Get_Grid_Cell(tObject& entity, int x, int y) {
-    std::string value = "";
-    int row_count = entity["rows"].number;
-    int col_count = entity["columns"].number;
+    int row_count = entity[eATOM_ROWS].number;
+    int col_count = entity[eATOM_COLUMNS].number;
     Check_Condition(((x >= 0) && (x < col_count)), "Invalid column accessed.");
     Check_Condition(((y >= 0) && (y < row_count)), "Invalid row accessed.");
-    cArray<std::string> rows = Parse_Sausage_Text(entity["text"].string, ";");
-    for (int grid_y = 0; grid_y < row_count; grid_y++) {
-      cArray<std::string> cells = Parse_Sausage_Text(rows[grid_y], ",");
-      for (int grid_x = 0; grid_x < col_count; grid_x++) {
-        if ((x == grid_x) && (y == grid_y)) {
-          value = cells[grid_x];
-          if (value == "free") {
-            value = "";
-          }
-          break;
-        }
-      }
+    std::string_view row = cTokenizer(entity[eATOM_TEXT].string, ';').Get_Token(y);
+    std::string value(cTokenizer(row, ',').Get_Token(x));
+    if (value == "free") {
+      value = "";
     }
     return value;
   }
@@ -3278,27 +6728,19 @@ namespace Nerd {
    * @throws An error if an invalid cell is accessed or if the value has invalid characters.
    */
   void cPage::Set_Grid_Cell(tObject& entity, int x, int y, std::string value) {
-    int row_count = entity["rows"].number;
-    int col_count = entity["columns"].number;
+    int row_count = entity[eATOM_ROWS].number;
+    int col_count = entity[eATOM_COLUMNS].number;
     Check_Condition(((x >= 0) && (x < col_count)), "Invalid column accessed.");
     Check_Condition(((y >= 0) && (y < row_count)), "Invalid row accessed.");
-    cArray<std::string> rows = Parse_Sausage_Text(entity["text"].string, ";");
-    for (int grid_y = 0; grid_y < row_count; grid_y++) {
-      cArray<std::string> cells = Parse_Sausage_Text(rows[grid_y], ",");
-      for (int grid_x = 0; grid_x < col_count; grid_x++) {
-        if ((x == grid_x) && (y == grid_y)) {
-          // Check for invalid characters.
-          Check_Condition(((value.find(';') == std::string::npos) && (value.find(',') == std::string::npos)), "Invalid characters in grid cell.");
-          if (value == "") {
-            value = "free";
-          }
-          cells[grid_x] = value;
-          rows[grid_y] = Join(cells, ",");
-          entity["text"].Set_String(Join(rows, ";"));
-          break;
-        }
-      }
+    // Check for invalid characters.
+    Check_Condition(((value.find(';') == std::string::npos) && (value.find(',') == std::string::npos)), "Invalid characters in grid cell.");
+    if (value == "") {
+      value = "free";
     }
+    std::string& grid_text = entity[eATOM_TEXT].string;
+    std::string_view row = cTokenizer(grid_text, ';').Get_Token(y);
+    std::string_view cell = cTokenizer(row, ',').Get_Token(x);
+    grid_text.replace(cell.data() - grid_text.data(), cell.length(), value);
   }
 
   /**
@@ -3308,10 +6750,16 @@ namespace Nerd {
    * @throws An error if the value has invalid values.
    */
   void cPage::Add_List_Item(tObject& entity, std::string value) {
-    cArray<std::string> items = Parse_Sausage_Text(entity["text"].string, ",");
     Check_Condition((value.find(',') == std::string::npos), "Invalid character in value.");
-    items.Add(value);
-    entity["text"].Set_String(Join(items, ","));
+    cTokenizer items(entity[eATOM_TEXT].string, ',');
+    std::string text;
+    std::string_view item;
+    while (items.Next(item)) {
+      text += item;
+      text += ',';
+    }
+    text += value;
+    entity[eATOM_TEXT].Set_String(std::move(text));
   }
 
   /**
@@ -3321,11 +6769,22 @@ namespace Nerd {
    * @throws An error if the index is invalid.
    */
   void cPage::Remove_List_Item(tObject& entity, int index) {
-    cArray<std::string> items = Parse_Sausage_Text(entity["text"].string, ",");
-    if (items.Count() > 0) {
-      items.Remove(index);
+    cTokenizer items(entity[eATOM_TEXT].string, ',');
+    int item_count = items.Count();
+    if (item_count > 0) {
+      Check_Condition(((index >= 0) && (index < item_count)), "Invalid list item index.");
+    }
+    std::string text;
+    std::string_view item;
+    for (int item_index = 0; items.Next(item); item_index++) {
+      if (item_index != index) {
+        if (text.length() > 0) {
+          text += ',';
+        }
+        text += item;
+      }
     }
-    entity["text"].Set_String(Join(items, ","));
+    entity[eATOM_TEXT].Set_String(std::move(text));
   }
 
   /**
@@ -3334,8 +6793,7 @@ namespace Nerd {
    * @return The list item count.
    */
   int cPage::Get_List_Item_Count(tObject& entity) {
-    cArray<std::string> items = Parse_Sausage_Text(entity["text"].string, ",");
-    return items.Count();
+    return cTokenizer(entity[eATOM_TEXT].string, ',').Count();
   }
 
   /**
@@ -3346,8 +6804,7 @@ namespace Nerd {
    * @throws An error if the index is invalid.
    */
   std::string cPage::Get_List_Item(tObject& entity, int index) {
-    cArray<std::string> items = Parse_Sausage_Text(entity["text"].string, ",");
-    return items[index];
+    return std::string(cTokenizer(entity[eATOM_TEXT].string, ',').Get_Token(index));
   }
 
   /**
@@ -3355,7 +6812,7 @@ namespace Nerd {
    * @param entity The list component.
    */
   void cPage::Clear_List(tObject& entity) {
-    entity["text"].Set_String("");
+    entity[eATOM_TEXT].Set_String("");
   }
 
   /**
@@ -3365,10 +6822,16 @@ namespace Nerd {
    * @throws An error if the value has invalid values.
    */
   void cPage::Add_Toolbar_Item(tObject& entity, std::string value) {
-    cArray<std::string> items = Parse_Sausage_Text(entity["text"].string, ",");
     Check_Condition((value.find(',') == std::string::npos), "Invalid character in value.");
-    items.Add(value);
-    entity["text"].Set_String(Join(items, ","));
+    cTokenizer items(entity[eATOM_TEXT].string, ',');
+    std::string text;
+    std::string_view item;
+    while (items.Next(item)) {
+      text += item;
+      text += ',';
+    }
+    text += value;
+    entity[eATOM_TEXT].Set_String(std::move(text));
   }
 
   /**
@@ -3378,11 +6841,22 @@ namespace Nerd {
    * @throws An error if the index is invalid.
    */
   void cPage::Remove_Toolbar_Item(tObject& entity, int index) {
-    cArray<std::string> items = Parse_Sausage_Text(entity["text"].string, ",");
-    if (items.Count() > 0) {
-      items.Remove(index);
+    cTokenizer items(entity[eATOM_TEXT].string, ',');
+    int item_count = items.Count();
+    if (item_count > 0) {
+      Check_Condition(((index >= 0) && (index < item_count)), "Invalid toolbar item index.");
+    }
+    std::string text;
+    std::string_view item;
+    for (int item_index = 0; items.Next(item); item_index++) {
+      if (item_index != index) {
+        if (text.length() > 0) {
+          text += ',';
+        }
+        text += item;
+      }
     }
-    entity["text"].Set_String(Join(items, ","));
+    entity[eATOM_TEXT].Set_String(std::move(text));
   }
 
   /**
@@ -3391,8 +6865,7 @@ namespace Nerd {
    * @return The toolbar item count.
    */
   int cPage::Get_Toolbar_Item_Count(tObject& entity) {
-    cArray<std::string> items = Parse_Sausage_Text(entity["text"].string, ",");
-    return items.Count();
+    return cTokenizer(entity[eATOM_TEXT].string, ',').Count();
   }
 
   /**
@@ -3400,7 +6873,7 @@ namespace Nerd {
    * @param entity The toolbar component.
    */
   void cPage::Clear_Toolbar(tObject& entity) {
-    entity["text"].Set_String("");
+    entity[eATOM_TEXT].Set_String("");
   }
 
   // **************************************************************************
@@ -3458,6 +6931,44 @@ namespace Nerd {
   // General Purpose API
   // **************************************************************************
 
+  /**
+   * Gets the atom table shared by the whole program.
+   * @return The atom table.
+   */
+  cAtom_Table& Get_Atom_Table() {
+    static cAtom_Table atom_table;
+    return atom_table;
+  }
+
+  /**
+   * Gets the worker pool shared by the whole program. It has a worker for
+   * every hardware thread but the one that runs the pool.
+   * @return The worker pool.
+   */
+  cWorker_Pool& Get_Worker_Pool() {
+    static cWorker_Pool worker_pool(std::max((int)std::thread::hardware_concurrency(), 1) - 1);
+    return worker_pool;
+  }
+
+  /**
+   * Interns a name in the shared atom table.
+   * @param name The name to intern.
+   * @return The atom of the name.
+   */
+  eAtom Intern_Atom(const std::string& name) {
+    return Get_Atom_Table().Intern(name);
+  }
+
+  /**
+   * Gets the name of an atom from the shared atom table.
+   * @param atom The atom.
+   * @return The name of the atom.
+   * @throws An error if the atom was never interned.
+   */
+  std::string& Get_Atom_Name(eAtom atom) {
+    return Get_Atom_Table().Get_Name(atom);
+  }
+
   /**
    * Parses sausage text which is like sausages bound with delimiter.
    * @param text The text to parse.
@@ -3466,97 +6977,314 @@ namespace Nerd {
    */
   cArray<std::string> Parse_Sausage_Text(std::string text, std::string delimiter) {
     cArray<std::string> tokens;
-    try {
-      std::size_t start = 0;
-      std::size_t end = text.find(delimiter, start);
-      while (end != std::string::npos) {
-        std::size_t count = end - start;
-        std::string token = text.substr(start, count);
-        if (token.length() > 0) { // No NULL tokens!
+    if (delimiter.length() == 1) {
+      cTokenizer tokenizer(text, delimiter[0]);
+      std::string_view token;
+      while (tokenizer.Next(token)) {
+        tokens.Add(std::string(token));
+      }
+    }
+    else {
+      try {
+        std::size_t start = 0;
+        std::size_t end = text.find(delimiter, start);
+        while (end != std::string::npos) {
+          std::size_t count = end - start;
+          std::string token = text.substr(start, count);
+          if (token.length() > 0) { // No NULL tokens!
+            tokens.Add(token);
+          }
+          start = end + delimiter.length();
+          end = text.find(delimiter, start);
+        }
+        // Get last token.
+        std::string token = text.substr(start);
+        if (token.length() > 0) {
           tokens.Add(token);
         }
-        start = end + delimiter.length();
-        end = text.find(delimiter, start);
       }
-      // Get last token.
-      std::string token = text.substr(start);
-      if (token.length() > 0) {
-        tokens.Add(token);
+      catch (std::out_of_range error) {
+        // Do nothing.
       }
     }
-    catch (std::out_of_range error) {
-      // Do nothing.
-    }
     return tokens;
   }
 
+  /**
+   * Tries to convert text to a number without throwing. A number is an
+   * optional minus sign followed by digits with no leading zeros. Negative
+   * zero is not a number.
+   * @param text The numeric text.
+   * @param number The converted number. It is only set if the conversion worked.
+   * @return eNUMBER_OK if the text was converted, otherwise the reason it was not.
+   */
+  eNumber_Status Try_Text_To_Number(std::string_view text, int& number) {
+    int digit_count = text.length();
+    if (digit_count == 0) {
+      return eNUMBER_EMPTY;
+    }
+    int start = (text[0] == '-') ? 1 : 0;
+    if (start == digit_count) { // Only a minus sign.
+      return eNUMBER_INVALID;
+    }
+    char letter = text[start];
+    if (letter == '0') { // Zero stands alone.
+      if (digit_count == 1) {
+        number = 0;
+        return eNUMBER_OK;
+      }
+      return eNUMBER_INVALID;
+    }
+    if ((letter < '1') || (letter > '9')) {
+      return eNUMBER_INVALID;
+    }
+    // The magnitude of the smallest int is one more than the largest.
+    unsigned int limit = (start == 1) ? 2147483648U : 2147483647U;
+    unsigned int value = 0;
+    bool overflow = false;
+    for (int digit_index = start; digit_index < digit_count; digit_index++) {
+      letter = text[digit_index];
+      if ((letter < '0') || (letter > '9')) {
+        return eNUMBER_INVALID;
+      }
+      unsigned int digit = letter - '0';
+      if (value > ((limit - digit) / 10)) {
+        overflow = true;
+      }
+      else {
+        value = (value * 10) + digit;
+      }
+    }
+    if (overflow) {
+      return eNUMBER_OVERFLOW;
+    }
+    number = (start == 1) ? (-(int)(value - 1) - 1) : (int)value;
+    return eNUMBER_OK;
+  }
+
   /**
    * Converts text to a number.
    * @param text The numeric text.
    * @return The integer number.
    * @throws An error if the number is invalid.
    */
-  int Text_To_Number(std::string text) {
+  int Text_To_Number(std::string_view text) {
     int number = 0;
-    if (text.length() > 0) {
-      char letter = text[0];
-      int start = 0;
-      int sign = 1;
-      if (letter == '0') {
-        start = 0;
-        sign = 0;
-      }
-      else if (letter == '-') {
-        start = 1;
-        sign = -1;
-      }
-      else if ((letter >= '1') && (letter <= '9')) { // Positive
-        start = 0;
-        sign = 1;
+    eNumber_Status status = Try_Text_To_Number(text, number);
+    if (status == eNUMBER_EMPTY) {
+      throw cError(std::string(text) + " is not a number.");
+    }
+    else if (status == eNUMBER_INVALID) {
+      throw cError("Invalid digit in " + std::string(text) + ".");
+    }
+    else if (status == eNUMBER_OVERFLOW) {
+      throw cError("Number " + std::string(text) + " is out of range.");
+    }
+    return number;
+  }
+
+  /**
+   * Parses a name=value line of an object and stores the field. Numeric values
+   * are stored as numbers. Lines that are not fields are ignored.
+   * @param line The line to parse.
+   * @param object The object to store the field in.
+   */
+  void Parse_Object_Field(std::string_view line, tObject& object) {
+    std::string_view pair[2];
+    if (cTokenizer(line, '=').Split(pair, 2) == 2) {
+      std::string name(pair[0]);
+      int number = 0;
+      if (Try_Text_To_Number(pair[1], number) == eNUMBER_OK) {
+        object[name] = cValue(number);
       }
       else {
-        throw cError("Invalid starting digit in " + text + ".");
-      }
-      // Process digits.
-      int digit_count = text.length();
-      for (int digit_index = start; digit_index < digit_count; digit_index++) {
-        letter = text[digit_index];
-        if (digit_index == start) { // Start digit testing.
-          if (sign < 0) { // Negative
-            if ((letter >= '1') && (letter <= '9')) {
-              number = (number * 10) + (letter - '0'); // Add digit.
-            }
-            else {
-              throw cError("Invalid start digit for negative number in " + text + ".");
-            }
-          }
-          else if (sign > 0) { // Positive
-            number = (number * 10) + (letter - '0');
-          }
-          else { // Zero
-            if (digit_count == 1) {
-              number = 0;
-            }
-            else {
-              throw cError("More than one digit for zero in " + text + ".");
-            }
-          }
-        }
-        else { // Rest of number.
-          if ((letter >= '0') && (letter <= '9')) {
-            number = (number * 10) + (letter - '0');
-          }
-          else {
-            throw cError("Invalid digit in next part of number for " + text + ".");
-          }
-        }
+        object[name] = cValue(std::string(pair[1]));
+      }
+    }
+  }
+
+  /**
+   * Reads the whole content of a file with a single read.
+   * @param name The name of the file.
+   * @param data The string to hold the content.
+   * @throws An error if the file could not be read.
+   */
+  void Read_File_Data(std::string name, std::string& data) {
+    std::ifstream file(name, std::ios::binary);
+    if (file) {
+      file.seekg(0, std::ios::end);
+      std::streamoff file_size = file.tellg();
+      Check_Condition(((file_size >= 0) && (file_size <= INT_MAX)), "File " + name + " is too big to read.");
+      int size = file_size;
+      file.seekg(0);
+      data.resize(size);
+      if (!file.read(&data[0], size)) {
+        throw cError("Problem reading file " + name + ".");
       }
-      number *= sign;
     }
     else {
-      throw cError(text + " is not a number.");
+      throw cError("Could not read file " + name + ".");
+    }
+  }
+
+  /**
+   * Rounds a row width up so each row starts on an aligned boundary.
+   * @param width The width of the row in cells.
+   * @param cell_size The size of a cell in bytes.
+   * @return The stride between rows in cells.
+   */
+  int Get_Aligned_Stride(int width, int cell_size) {
+    int count = MEMORY_ALIGNMENT / cell_size;
+    return ((width + count - 1) / count) * count;
+  }
+
+  /**
+   * Allocates a cleared and aligned buffer.
+   * @param size The size of the buffer in bytes.
+   * @return The buffer. It must be freed with Free_Buffer.
+   */
+  void* Allocate_Buffer(std::size_t size) {
+    void* buffer = ::operator new[](size, std::align_val_t(MEMORY_ALIGNMENT));
+    std::memset(buffer, 0, size);
+    return buffer;
+  }
+
+  /**
+   * Frees a buffer made with Allocate_Buffer.
+   * @param buffer The buffer to free. It may be NULL.
+   */
+  void Free_Buffer(void* buffer) {
+    if (buffer) {
+      ::operator delete[](buffer, std::align_val_t(MEMORY_ALIGNMENT));
     }
-    return number;
+  }
+
+  /**
+   * Reads the header of a binary table file. The file holds the magic NRDT,
+   * the version, the cell size in bytes, the width and the height followed by
+   * the rows of little endian cells. Version 1 files have no cell size and
+   * hold 32-bit cells.
+   * @param data The content of the file.
+   * @param size The size of the content.
+   * @param name The name of the file.
+   * @param width The width of the table.
+   * @param height The height of the table.
+   * @param cell_size The size of a cell.
+   * @return The offset of the first row.
+   * @throws An error if the header is invalid or does not match the size.
+   */
+  int Read_Table_Header(const char* data, std::size_t size, std::string name, int& width, int& height, int& cell_size) {
+    cByte_Reader reader(data, (size < TABLE_FILE_HEADER_SIZE) ? size : TABLE_FILE_HEADER_SIZE);
+    Check_Condition((reader.Read_Bytes(4) == "NRDT"), "File " + name + " is not a binary table file.");
+    int version = reader.Read_Int32();
+    Check_Condition(((version == 1) || (version == TABLE_FILE_VERSION)), "Unsupported table file version in " + name + ".");
+    cell_size = (version == 1) ? 4 : reader.Read_Int32();
+    Check_Condition(((cell_size == 1) || (cell_size == 2) || (cell_size == 4)), "Invalid cell size in " + name + ".");
+    width = reader.Read_Int32();
+    height = reader.Read_Int32();
+    Check_Condition(((width >= 0) && (height >= 0)), "Invalid table size in " + name + ".");
+    int offset = reader.pointer;
+    Check_Condition((size == (offset + ((std::size_t)width * height * cell_size))), "Table data in " + name + " does not match its size.");
+    return offset;
+  }
+
+  /**
+   * Finds the best vector instructions the machine has for blitting. AVX2 is
+   * left out when NERD_AVX2 is off, which it is for MinGW.
+   * @return The eSIMD_Level of the machine.
+   */
+  int Detect_SIMD_Level() {
+    int level = eSIMD_SCALAR;
+#if NERD_SIMD
+    level = eSIMD_SSE2;
+  #if NERD_AVX2
+    #ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] >= 7) {
+      __cpuid(info, 1);
+      bool os_saves_avx = ((info[2] & (1 << 27)) != 0) && ((info[2] & (1 << 28)) != 0) && ((_xgetbv(0) & 6) == 6);
+      __cpuidex(info, 7, 0);
+      if (os_saves_avx && ((info[1] & (1 << 5)) != 0)) {
+        level = eSIMD_AVX2;
+      }
+    }
+    #else
+    if (__builtin_cpu_supports("avx2")) {
+      level = eSIMD_AVX2;
+    }
+    #endif
+  #endif
+#endif
+    return level;
+  }
+
+  /**
+   * Gets the shared SIMD level setting. It starts at the level of the machine.
+   * @return The setting.
+   */
+  int& Get_SIMD_Setting() {
+    static int level = Detect_SIMD_Level();
+    return level;
+  }
+
+  /**
+   * Gets the SIMD level used for blitting.
+   * @return The eSIMD_Level in use.
+   */
+  int Get_SIMD_Level() {
+    return Get_SIMD_Setting();
+  }
+
+  /**
+   * Sets the SIMD level used for blitting. The level cannot go above what the
+   * machine supports. This is mostly for profiling the fallbacks.
+   * @param level The eSIMD_Level to use.
+   */
+  void Set_SIMD_Level(int level) {
+    int best = Detect_SIMD_Level();
+    Get_SIMD_Setting() = (level > best) ? best : ((level < eSIMD_SCALAR) ? eSIMD_SCALAR : level);
+  }
+
+  /**
+   * Gets the bounding box of two rectangles.
+   * @param first The first rectangle.
+   * @param second The second rectangle.
+   * @return The rectangle that holds both.
+   */
+  sRectangle Merge_Rectangles(sRectangle first, sRectangle second) {
+    sRectangle merged = { std::min(first.left, second.left), std::min(first.top, second.top), std::max(first.right, second.right), std::max(first.bottom, second.bottom) };
+    return merged;
+  }
+
+  /**
+   * Gets the number of cells in a rectangle. The right and bottom edges are
+   * part of the rectangle.
+   * @param rect The rectangle.
+   * @return The area.
+   */
+  long long Get_Rectangle_Area(sRectangle rect) {
+    return (long long)(rect.right - rect.left + 1) * (rect.bottom - rect.top + 1);
+  }
+
+  /**
+   * Divides a number and rounds down, so that negative numbers go to the
+   * lower whole number instead of toward zero.
+   * @param value The number to divide.
+   * @param divisor The positive number to divide by.
+   * @return The rounded down quotient.
+   */
+  int Floor_Divide(int value, int divisor) {
+    return (value >= 0) ? (value / divisor) : -((-value + divisor - 1) / divisor);
+  }
+
+  /**
+   * Determines if numbers are stored in little endian byte order.
+   * @return True if the machine is little endian, false otherwise.
+   */
+  bool Is_Little_Endian() {
+    int number = 1;
+    return ((*(char*)&number) == 1);
   }
 
   /**
@@ -3565,31 +7293,60 @@ namespace Nerd {
    * @return The text version of the number.
    */
   std::string Number_To_Text(int number) {
-    cArray<char> buffer;
-    char sign = 0;
-    if (number == 0) {
-      buffer.Unshift('0');
-    }
-    else if (number < 0) {
-      sign = '-';
-      number *= -1; // Make positive.
-    }
-    while (number > 0) {
-      int remainder = (number % 10);
-      char digit = remainder + '0'; // Normalize to character.
-      number -= remainder;
-      number /= 10;
-      buffer.Unshift(digit);
-    }
-    if (sign) {
-      buffer.Unshift(sign);
-    }
-    int letter_count = buffer.Count();
-    std::string text = "";
-    for (int letter_index = 0; letter_index < letter_count; letter_index++) {
-      text += buffer[letter_index];
+    char buffer[NUMBER_TEXT_SIZE];
+    int length = Format_Number(number, buffer);
+    return std::string(buffer, length);
+  }
+
+  /**
+   * Formats a number as text into a buffer. Digits are produced two at a time
+   * from a lookup table. The buffer is not null terminated.
+   * @param number The number to format.
+   * @param buffer The buffer to write to. It must hold NUMBER_TEXT_SIZE letters.
+   * @return The number of letters written.
+   */
+  int Format_Number(int number, char* buffer) {
+    static const char digit_pairs[] =
+      "0001020304050607080910111213141516171819"
+      "2021222324252627282930313233343536373839"
+      "4041424344454647484950515253545556575859"
+      "6061626364656667686970717273747576777879"
+      "8081828384858687888990919293949596979899";
+    char digits[NUMBER_TEXT_SIZE];
+    int position = NUMBER_TEXT_SIZE;
+    // Work with the magnitude as unsigned so the smallest int is handled.
+    unsigned int value = (number < 0) ? (0U - (unsigned int)number) : (unsigned int)number;
+    while (value >= 100) {
+      unsigned int pair = (value % 100) * 2;
+      value /= 100;
+      digits[--position] = digit_pairs[pair + 1];
+      digits[--position] = digit_pairs[pair];
+    }
+    if (value >= 10) {
+      unsigned int pair = value * 2;
+      digits[--position] = digit_pairs[pair + 1];
+      digits[--position] = digit_pairs[pair];
     }
-    return text;
+    else {
+      digits[--position] = (char)('0' + value);
+    }
+    if (number < 0) {
+      digits[--position] = '-';
+    }
+    int length = NUMBER_TEXT_SIZE - position;
+    std::memcpy(buffer, digits + position, length);
+    return length;
+  }
+
+  /**
+   * Appends a number as text to the end of a string.
+   * @param text The string to append to.
+   * @param number The number to append.
+   */
+  void Append_Number(std::string& text, int number) {
+    char buffer[NUMBER_TEXT_SIZE];
+    int length = Format_Number(number, buffer);
+    text.append(buffer, length);
   }
 
   /**
@@ -3598,24 +7355,11 @@ namespace Nerd {
    * @return An array of tokens. None are NULL.
    */
   cArray<std::string> Parse_C_Lesh_Line(std::string line) {
-    int letter_count = line.length();
-    std::string token = "";
     cArray<std::string> tokens;
-    for (int letter_index = 0; letter_index < letter_count; letter_index++) {
-      char letter = line[letter_index];
-      if ((letter == ' ') || (letter == '\t')) {
-        if (token.length() > 0) {
-          tokens.Add(token);
-          token = "";
-        }
-      }
-      else { // Non-whitespace.
-        token += letter;
-      }
-    }
-    // Add last token.
-    if (token.length() > 0) {
-      tokens.Add(token);
+    cTokenizer tokenizer(line);
+    std::string_view token;
+    while (tokenizer.Next(token)) {
+      tokens.Add(std::string(token));
     }
     return tokens;
   }
@@ -3682,4 +7426,17 @@ namespace Nerd {
     }
   }
 
+  /**
+   * Checks to see if a condition holds. The message is only turned into a
+   * string when the condition fails.
+   * @param condition The condition to test.
+   * @param message The error message.
+   * @throws An error if the condition is false.
+   */
+  void Check_Condition(bool condition, const char* message) {
+    if (!condition) {
+      throw cError(message);
+    }
+  }
+
 }
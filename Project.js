@@ -361,7 +361,7 @@ class cProject {
         let shell = new nerd.cShell();
         let batch = [
           "windres Icon.rc -O coff -o Icon.res",
-          "g++ -o " + this.project + " " + this.project + ".cpp " + library + " " + include + " Icon.res " + libs.join(" ")
+          "g++ -std=c++17 -o " + this.project + " " + this.project + ".cpp " + library + " " + include + " Icon.res " + libs.join(" ")
         ];
         shell.Execute_Batch(batch, 0, function() {
           console.log("Compilation complete!");